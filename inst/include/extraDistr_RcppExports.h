@@ -360,6 +360,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qbhatt(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& a, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qbhatt)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qbhatt p_cpp_qbhatt = NULL;
+        if (p_cpp_qbhatt == NULL) {
+            validateSignature("NumericVector(*cpp_qbhatt)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qbhatt = (Ptr_cpp_qbhatt)R_GetCCallable("extraDistr", "_extraDistr_cpp_qbhatt");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qbhatt(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rbhatt(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& a) {
         typedef SEXP(*Ptr_cpp_rbhatt)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rbhatt p_cpp_rbhatt = NULL;
@@ -465,6 +486,48 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_dcens_fatigue(const NumericVector& x, const NumericVector& status, const NumericVector& alpha, const NumericVector& beta, const NumericVector& mu, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_fatigue)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_fatigue p_cpp_dcens_fatigue = NULL;
+        if (p_cpp_dcens_fatigue == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_fatigue)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_fatigue = (Ptr_cpp_dcens_fatigue)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_fatigue");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_fatigue(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_hazard_fatigue(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const NumericVector& mu, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_fatigue)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_fatigue p_cpp_hazard_fatigue = NULL;
+        if (p_cpp_hazard_fatigue == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_fatigue)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_fatigue = (Ptr_cpp_hazard_fatigue)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_fatigue");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_fatigue(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dbnorm(const NumericVector& x, const NumericVector& y, const NumericVector& mu1, const NumericVector& mu2, const NumericVector& sigma1, const NumericVector& sigma2, const NumericVector& rho, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dbnorm)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dbnorm p_cpp_dbnorm = NULL;
@@ -654,6 +717,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericMatrix cpp_rcopula(const int& n, const NumericMatrix& corr, const CharacterVector& family, const NumericMatrix& theta, const double& df) {
+        typedef SEXP(*Ptr_cpp_rcopula)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rcopula p_cpp_rcopula = NULL;
+        if (p_cpp_rcopula == NULL) {
+            validateSignature("NumericMatrix(*cpp_rcopula)(const int&,const NumericMatrix&,const CharacterVector&,const NumericMatrix&,const double&)");
+            p_cpp_rcopula = (Ptr_cpp_rcopula)R_GetCCallable("extraDistr", "_extraDistr_cpp_rcopula");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rcopula(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(corr)), Shield<SEXP>(Rcpp::wrap(family)), Shield<SEXP>(Rcpp::wrap(theta)), Shield<SEXP>(Rcpp::wrap(df)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericMatrix >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_ddirichlet(const NumericMatrix& x, const NumericMatrix& alpha, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_ddirichlet)(SEXP,SEXP,SEXP);
         static Ptr_cpp_ddirichlet p_cpp_ddirichlet = NULL;
@@ -759,6 +843,69 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_pdgamma(const NumericVector& x, const NumericVector& shape, const NumericVector& scale, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pdgamma)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pdgamma p_cpp_pdgamma = NULL;
+        if (p_cpp_pdgamma == NULL) {
+            validateSignature("NumericVector(*cpp_pdgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_pdgamma = (Ptr_cpp_pdgamma)R_GetCCallable("extraDistr", "_extraDistr_cpp_pdgamma");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_pdgamma(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(shape)), Shield<SEXP>(Rcpp::wrap(scale)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_qdgamma(const NumericVector& p, const NumericVector& shape, const NumericVector& scale, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qdgamma)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qdgamma p_cpp_qdgamma = NULL;
+        if (p_cpp_qdgamma == NULL) {
+            validateSignature("NumericVector(*cpp_qdgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qdgamma = (Ptr_cpp_qdgamma)R_GetCCallable("extraDistr", "_extraDistr_cpp_qdgamma");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qdgamma(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(shape)), Shield<SEXP>(Rcpp::wrap(scale)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rdgamma(const int& n, const NumericVector& shape, const NumericVector& scale) {
+        typedef SEXP(*Ptr_cpp_rdgamma)(SEXP,SEXP,SEXP);
+        static Ptr_cpp_rdgamma p_cpp_rdgamma = NULL;
+        if (p_cpp_rdgamma == NULL) {
+            validateSignature("NumericVector(*cpp_rdgamma)(const int&,const NumericVector&,const NumericVector&)");
+            p_cpp_rdgamma = (Ptr_cpp_rdgamma)R_GetCCallable("extraDistr", "_extraDistr_cpp_rdgamma");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rdgamma(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(shape)), Shield<SEXP>(Rcpp::wrap(scale)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_ddlaplace(const NumericVector& x, const NumericVector& location, const NumericVector& scale, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_ddlaplace)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_ddlaplace p_cpp_ddlaplace = NULL;
@@ -990,17 +1137,122 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rdweibull(const int& n, const NumericVector& q, const NumericVector& beta) {
-        typedef SEXP(*Ptr_cpp_rdweibull)(SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rdweibull(const int& n, const NumericVector& q, const NumericVector& beta, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rdweibull)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rdweibull p_cpp_rdweibull = NULL;
         if (p_cpp_rdweibull == NULL) {
-            validateSignature("NumericVector(*cpp_rdweibull)(const int&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rdweibull)(const int&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rdweibull = (Ptr_cpp_rdweibull)R_GetCCallable("extraDistr", "_extraDistr_cpp_rdweibull");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rdweibull(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(q)), Shield<SEXP>(Rcpp::wrap(beta)));
+            rcpp_result_gen = p_cpp_rdweibull(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(q)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dcens_dweibull(const NumericVector& x, const NumericVector& status, const NumericVector& q, const NumericVector& beta, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_dweibull)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_dweibull p_cpp_dcens_dweibull = NULL;
+        if (p_cpp_dcens_dweibull == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_dweibull)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_dweibull = (Ptr_cpp_dcens_dweibull)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_dweibull");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_dweibull(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(q)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dmix(const NumericVector& x, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dmix)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dmix p_cpp_dmix = NULL;
+        if (p_cpp_dmix == NULL) {
+            validateSignature("NumericVector(*cpp_dmix)(const NumericVector&,const CharacterVector&,const NumericMatrix&,const NumericVector&,const bool&)");
+            p_cpp_dmix = (Ptr_cpp_dmix)R_GetCCallable("extraDistr", "_extraDistr_cpp_dmix");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dmix(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(family)), Shield<SEXP>(Rcpp::wrap(theta)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_pmix(const NumericVector& x, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pmix)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pmix p_cpp_pmix = NULL;
+        if (p_cpp_pmix == NULL) {
+            validateSignature("NumericVector(*cpp_pmix)(const NumericVector&,const CharacterVector&,const NumericMatrix&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_pmix = (Ptr_cpp_pmix)R_GetCCallable("extraDistr", "_extraDistr_cpp_pmix");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_pmix(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(family)), Shield<SEXP>(Rcpp::wrap(theta)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_qmix(const NumericVector& p, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qmix)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qmix p_cpp_qmix = NULL;
+        if (p_cpp_qmix == NULL) {
+            validateSignature("NumericVector(*cpp_qmix)(const NumericVector&,const CharacterVector&,const NumericMatrix&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qmix = (Ptr_cpp_qmix)R_GetCCallable("extraDistr", "_extraDistr_cpp_qmix");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qmix(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(family)), Shield<SEXP>(Rcpp::wrap(theta)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rmix(const int& n, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha) {
+        typedef SEXP(*Ptr_cpp_rmix)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rmix p_cpp_rmix = NULL;
+        if (p_cpp_rmix == NULL) {
+            validateSignature("NumericVector(*cpp_rmix)(const int&,const CharacterVector&,const NumericMatrix&,const NumericVector&)");
+            p_cpp_rmix = (Ptr_cpp_rmix)R_GetCCallable("extraDistr", "_extraDistr_cpp_rmix");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rmix(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(family)), Shield<SEXP>(Rcpp::wrap(theta)), Shield<SEXP>(Rcpp::wrap(alpha)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1074,17 +1326,101 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rfrechet(const int& n, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma) {
-        typedef SEXP(*Ptr_cpp_rfrechet)(SEXP,SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rfrechet(const int& n, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rfrechet)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rfrechet p_cpp_rfrechet = NULL;
         if (p_cpp_rfrechet == NULL) {
-            validateSignature("NumericVector(*cpp_rfrechet)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rfrechet)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rfrechet = (Ptr_cpp_rfrechet)R_GetCCallable("extraDistr", "_extraDistr_cpp_rfrechet");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rfrechet(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)));
+            rcpp_result_gen = p_cpp_rfrechet(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_frechet(const int& n, const NumericVector& size, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_frechet)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_frechet p_cpp_rextreme_frechet = NULL;
+        if (p_cpp_rextreme_frechet == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_frechet)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_frechet = (Ptr_cpp_rextreme_frechet)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_frechet");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_frechet(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(minimum)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_pfrechet_interval(const NumericVector& a, const NumericVector& b, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pfrechet_interval)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pfrechet_interval p_cpp_pfrechet_interval = NULL;
+        if (p_cpp_pfrechet_interval == NULL) {
+            validateSignature("NumericVector(*cpp_pfrechet_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_pfrechet_interval = (Ptr_cpp_pfrechet_interval)R_GetCCallable("extraDistr", "_extraDistr_cpp_pfrechet_interval");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_pfrechet_interval(Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dcens_frechet(const NumericVector& x, const NumericVector& status, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_frechet)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_frechet p_cpp_dcens_frechet = NULL;
+        if (p_cpp_dcens_frechet == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_frechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_frechet = (Ptr_cpp_dcens_frechet)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_frechet");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_frechet(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_hazard_frechet(const NumericVector& x, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_frechet)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_frechet p_cpp_hazard_frechet = NULL;
+        if (p_cpp_hazard_frechet == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_frechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_frechet = (Ptr_cpp_hazard_frechet)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_frechet");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_frechet(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1221,17 +1557,17 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rgev(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi) {
-        typedef SEXP(*Ptr_cpp_rgev)(SEXP,SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rgev(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rgev)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rgev p_cpp_rgev = NULL;
         if (p_cpp_rgev == NULL) {
-            validateSignature("NumericVector(*cpp_rgev)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rgev)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rgev = (Ptr_cpp_rgev)R_GetCCallable("extraDistr", "_extraDistr_cpp_rgev");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rgev(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)));
+            rcpp_result_gen = p_cpp_rgev(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(sorted)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1242,17 +1578,17 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_dgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, bool log_prob = false) {
-        typedef SEXP(*Ptr_cpp_dgompertz)(SEXP,SEXP,SEXP,SEXP);
-        static Ptr_cpp_dgompertz p_cpp_dgompertz = NULL;
-        if (p_cpp_dgompertz == NULL) {
-            validateSignature("NumericVector(*cpp_dgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,bool)");
-            p_cpp_dgompertz = (Ptr_cpp_dgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_dgompertz");
+    inline NumericVector cpp_rextreme_gev(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_gev)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_gev p_cpp_rextreme_gev = NULL;
+        if (p_cpp_rextreme_gev == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_gev)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_gev = (Ptr_cpp_rextreme_gev)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_gev");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_dgompertz(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+            rcpp_result_gen = p_cpp_rextreme_gev(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(minimum)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1263,17 +1599,17 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_pgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail = true, const bool& log_prob = false) {
-        typedef SEXP(*Ptr_cpp_pgompertz)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_cpp_pgompertz p_cpp_pgompertz = NULL;
-        if (p_cpp_pgompertz == NULL) {
-            validateSignature("NumericVector(*cpp_pgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-            p_cpp_pgompertz = (Ptr_cpp_pgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_pgompertz");
+    inline NumericMatrix cpp_dgev_outer(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dgev_outer)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dgev_outer p_cpp_dgev_outer = NULL;
+        if (p_cpp_dgev_outer == NULL) {
+            validateSignature("NumericMatrix(*cpp_dgev_outer)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dgev_outer = (Ptr_cpp_dgev_outer)R_GetCCallable("extraDistr", "_extraDistr_cpp_dgev_outer");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_pgompertz(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+            rcpp_result_gen = p_cpp_dgev_outer(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1281,20 +1617,20 @@ namespace extraDistr {
             throw Rcpp::LongjumpException(rcpp_result_gen);
         if (rcpp_result_gen.inherits("try-error"))
             throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
-        return Rcpp::as<NumericVector >(rcpp_result_gen);
+        return Rcpp::as<NumericMatrix >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_qgompertz(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail = true, const bool& log_prob = false) {
-        typedef SEXP(*Ptr_cpp_qgompertz)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_cpp_qgompertz p_cpp_qgompertz = NULL;
-        if (p_cpp_qgompertz == NULL) {
-            validateSignature("NumericVector(*cpp_qgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-            p_cpp_qgompertz = (Ptr_cpp_qgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_qgompertz");
+    inline NumericMatrix cpp_pgev_outer(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pgev_outer)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pgev_outer p_cpp_pgev_outer = NULL;
+        if (p_cpp_pgev_outer == NULL) {
+            validateSignature("NumericMatrix(*cpp_pgev_outer)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_pgev_outer = (Ptr_cpp_pgev_outer)R_GetCCallable("extraDistr", "_extraDistr_cpp_pgev_outer");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_qgompertz(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+            rcpp_result_gen = p_cpp_pgev_outer(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1302,20 +1638,20 @@ namespace extraDistr {
             throw Rcpp::LongjumpException(rcpp_result_gen);
         if (rcpp_result_gen.inherits("try-error"))
             throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
-        return Rcpp::as<NumericVector >(rcpp_result_gen);
+        return Rcpp::as<NumericMatrix >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rgompertz(const int& n, const NumericVector& a, const NumericVector& b) {
-        typedef SEXP(*Ptr_cpp_rgompertz)(SEXP,SEXP,SEXP);
-        static Ptr_cpp_rgompertz p_cpp_rgompertz = NULL;
-        if (p_cpp_rgompertz == NULL) {
-            validateSignature("NumericVector(*cpp_rgompertz)(const int&,const NumericVector&,const NumericVector&)");
-            p_cpp_rgompertz = (Ptr_cpp_rgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_rgompertz");
+    inline NumericVector cpp_pgev_interval(const NumericVector& a, const NumericVector& b, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pgev_interval)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pgev_interval p_cpp_pgev_interval = NULL;
+        if (p_cpp_pgev_interval == NULL) {
+            validateSignature("NumericVector(*cpp_pgev_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_pgev_interval = (Ptr_cpp_pgev_interval)R_GetCCallable("extraDistr", "_extraDistr_cpp_pgev_interval");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rgompertz(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)));
+            rcpp_result_gen = p_cpp_pgev_interval(Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1326,10 +1662,178 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_dgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob = false) {
-        typedef SEXP(*Ptr_cpp_dgpd)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_cpp_dgpd p_cpp_dgpd = NULL;
-        if (p_cpp_dgpd == NULL) {
+    inline NumericVector cpp_hazard_gev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_gev)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_gev p_cpp_hazard_gev = NULL;
+        if (p_cpp_hazard_gev == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_gev)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_gev = (Ptr_cpp_hazard_gev)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_gev");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_gev(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, bool log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dgompertz)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dgompertz p_cpp_dgompertz = NULL;
+        if (p_cpp_dgompertz == NULL) {
+            validateSignature("NumericVector(*cpp_dgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,bool)");
+            p_cpp_dgompertz = (Ptr_cpp_dgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_dgompertz");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dgompertz(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_pgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pgompertz)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pgompertz p_cpp_pgompertz = NULL;
+        if (p_cpp_pgompertz == NULL) {
+            validateSignature("NumericVector(*cpp_pgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_pgompertz = (Ptr_cpp_pgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_pgompertz");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_pgompertz(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_qgompertz(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qgompertz)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qgompertz p_cpp_qgompertz = NULL;
+        if (p_cpp_qgompertz == NULL) {
+            validateSignature("NumericVector(*cpp_qgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qgompertz = (Ptr_cpp_qgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_qgompertz");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qgompertz(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rgompertz(const int& n, const NumericVector& a, const NumericVector& b, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rgompertz)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rgompertz p_cpp_rgompertz = NULL;
+        if (p_cpp_rgompertz == NULL) {
+            validateSignature("NumericVector(*cpp_rgompertz)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rgompertz = (Ptr_cpp_rgompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_rgompertz");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rgompertz(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_gompertz(const int& n, const NumericVector& size, const NumericVector& a, const NumericVector& b, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_gompertz)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_gompertz p_cpp_rextreme_gompertz = NULL;
+        if (p_cpp_rextreme_gompertz == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_gompertz)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_gompertz = (Ptr_cpp_rextreme_gompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_gompertz");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_gompertz(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(minimum)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dcens_gompertz(const NumericVector& x, const NumericVector& status, const NumericVector& a, const NumericVector& b, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_gompertz)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_gompertz p_cpp_dcens_gompertz = NULL;
+        if (p_cpp_dcens_gompertz == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_gompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_gompertz = (Ptr_cpp_dcens_gompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_gompertz");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_gompertz(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_hazard_gompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_gompertz)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_gompertz p_cpp_hazard_gompertz = NULL;
+        if (p_cpp_hazard_gompertz == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_gompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_gompertz = (Ptr_cpp_hazard_gompertz)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_gompertz");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_gompertz(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dgpd)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dgpd p_cpp_dgpd = NULL;
+        if (p_cpp_dgpd == NULL) {
             validateSignature("NumericVector(*cpp_dgpd)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_dgpd = (Ptr_cpp_dgpd)R_GetCCallable("extraDistr", "_extraDistr_cpp_dgpd");
         }
@@ -1389,17 +1893,59 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rgpd(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi) {
-        typedef SEXP(*Ptr_cpp_rgpd)(SEXP,SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rgpd(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rgpd)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rgpd p_cpp_rgpd = NULL;
         if (p_cpp_rgpd == NULL) {
-            validateSignature("NumericVector(*cpp_rgpd)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rgpd)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rgpd = (Ptr_cpp_rgpd)R_GetCCallable("extraDistr", "_extraDistr_cpp_rgpd");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rgpd(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)));
+            rcpp_result_gen = p_cpp_rgpd(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_gpd(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_gpd)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_gpd p_cpp_rextreme_gpd = NULL;
+        if (p_cpp_rextreme_gpd == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_gpd)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_gpd = (Ptr_cpp_rextreme_gpd)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_gpd");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_gpd(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(minimum)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_pgpd_interval(const NumericVector& a, const NumericVector& b, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pgpd_interval)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pgpd_interval p_cpp_pgpd_interval = NULL;
+        if (p_cpp_pgpd_interval == NULL) {
+            validateSignature("NumericVector(*cpp_pgpd_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_pgpd_interval = (Ptr_cpp_pgpd_interval)R_GetCCallable("extraDistr", "_extraDistr_cpp_pgpd_interval");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_pgpd_interval(Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1410,6 +1956,48 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_hazard_gpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_gpd)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_gpd p_cpp_hazard_gpd = NULL;
+        if (p_cpp_hazard_gpd == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_gpd)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_gpd = (Ptr_cpp_hazard_gpd)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_gpd");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_gpd(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(xi)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List cpp_gpd_threshold(const Rcpp::List& series, const NumericVector& threshold, const int& min_exceed = 10, const int& maxit = 100, const double& tol = 1e-8) {
+        typedef SEXP(*Ptr_cpp_gpd_threshold)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_gpd_threshold p_cpp_gpd_threshold = NULL;
+        if (p_cpp_gpd_threshold == NULL) {
+            validateSignature("Rcpp::List(*cpp_gpd_threshold)(const Rcpp::List&,const NumericVector&,const int&,const int&,const double&)");
+            p_cpp_gpd_threshold = (Ptr_cpp_gpd_threshold)R_GetCCallable("extraDistr", "_extraDistr_cpp_gpd_threshold");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_gpd_threshold(Shield<SEXP>(Rcpp::wrap(series)), Shield<SEXP>(Rcpp::wrap(threshold)), Shield<SEXP>(Rcpp::wrap(min_exceed)), Shield<SEXP>(Rcpp::wrap(maxit)), Shield<SEXP>(Rcpp::wrap(tol)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dgumbel(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dgumbel)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dgumbel p_cpp_dgumbel = NULL;
@@ -1473,17 +2061,80 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rgumbel(const int& n, const NumericVector& mu, const NumericVector& sigma) {
-        typedef SEXP(*Ptr_cpp_rgumbel)(SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rgumbel(const int& n, const NumericVector& mu, const NumericVector& sigma, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rgumbel)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rgumbel p_cpp_rgumbel = NULL;
         if (p_cpp_rgumbel == NULL) {
-            validateSignature("NumericVector(*cpp_rgumbel)(const int&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rgumbel)(const int&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rgumbel = (Ptr_cpp_rgumbel)R_GetCCallable("extraDistr", "_extraDistr_cpp_rgumbel");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rgumbel(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)));
+            rcpp_result_gen = p_cpp_rgumbel(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_gumbel(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_gumbel)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_gumbel p_cpp_rextreme_gumbel = NULL;
+        if (p_cpp_rextreme_gumbel == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_gumbel)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_gumbel = (Ptr_cpp_rextreme_gumbel)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_gumbel");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_gumbel(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(minimum)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_pgumbel_interval(const NumericVector& a, const NumericVector& b, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_pgumbel_interval)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_pgumbel_interval p_cpp_pgumbel_interval = NULL;
+        if (p_cpp_pgumbel_interval == NULL) {
+            validateSignature("NumericVector(*cpp_pgumbel_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_pgumbel_interval = (Ptr_cpp_pgumbel_interval)R_GetCCallable("extraDistr", "_extraDistr_cpp_pgumbel_interval");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_pgumbel_interval(Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_hazard_gumbel(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_gumbel)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_gumbel p_cpp_hazard_gumbel = NULL;
+        if (p_cpp_hazard_gumbel == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_gumbel)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_gumbel = (Ptr_cpp_hazard_gumbel)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_gumbel");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_gumbel(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1809,17 +2460,80 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rhuber(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon) {
-        typedef SEXP(*Ptr_cpp_rhuber)(SEXP,SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rhuber(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rhuber)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rhuber p_cpp_rhuber = NULL;
         if (p_cpp_rhuber == NULL) {
-            validateSignature("NumericVector(*cpp_rhuber)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rhuber)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rhuber = (Ptr_cpp_rhuber)R_GetCCallable("extraDistr", "_extraDistr_cpp_rhuber");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rhuber(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(epsilon)));
+            rcpp_result_gen = p_cpp_rhuber(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(epsilon)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_huber(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_huber)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_huber p_cpp_rextreme_huber = NULL;
+        if (p_cpp_rextreme_huber == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_huber)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_huber = (Ptr_cpp_rextreme_huber)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_huber");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_huber(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(epsilon)), Shield<SEXP>(Rcpp::wrap(minimum)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_huber_rho(const NumericVector& x, const NumericVector& epsilon) {
+        typedef SEXP(*Ptr_cpp_huber_rho)(SEXP,SEXP);
+        static Ptr_cpp_huber_rho p_cpp_huber_rho = NULL;
+        if (p_cpp_huber_rho == NULL) {
+            validateSignature("NumericVector(*cpp_huber_rho)(const NumericVector&,const NumericVector&)");
+            p_cpp_huber_rho = (Ptr_cpp_huber_rho)R_GetCCallable("extraDistr", "_extraDistr_cpp_huber_rho");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_huber_rho(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(epsilon)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_huber_psi(const NumericVector& x, const NumericVector& epsilon) {
+        typedef SEXP(*Ptr_cpp_huber_psi)(SEXP,SEXP);
+        static Ptr_cpp_huber_psi p_cpp_huber_psi = NULL;
+        if (p_cpp_huber_psi == NULL) {
+            validateSignature("NumericVector(*cpp_huber_psi)(const NumericVector&,const NumericVector&)");
+            p_cpp_huber_psi = (Ptr_cpp_huber_psi)R_GetCCallable("extraDistr", "_extraDistr_cpp_huber_psi");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_huber_psi(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(epsilon)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -1830,6 +2544,69 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_huber_weight(const NumericVector& x, const NumericVector& epsilon) {
+        typedef SEXP(*Ptr_cpp_huber_weight)(SEXP,SEXP);
+        static Ptr_cpp_huber_weight p_cpp_huber_weight = NULL;
+        if (p_cpp_huber_weight == NULL) {
+            validateSignature("NumericVector(*cpp_huber_weight)(const NumericVector&,const NumericVector&)");
+            p_cpp_huber_weight = (Ptr_cpp_huber_weight)R_GetCCallable("extraDistr", "_extraDistr_cpp_huber_weight");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_huber_weight(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(epsilon)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline double cpp_huber_scale(const NumericVector& x, const double& epsilon = 1.345, const bool& proposal2 = false, const int& maxit = 50, const double& tol = 1e-6) {
+        typedef SEXP(*Ptr_cpp_huber_scale)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_huber_scale p_cpp_huber_scale = NULL;
+        if (p_cpp_huber_scale == NULL) {
+            validateSignature("double(*cpp_huber_scale)(const NumericVector&,const double&,const bool&,const int&,const double&)");
+            p_cpp_huber_scale = (Ptr_cpp_huber_scale)R_GetCCallable("extraDistr", "_extraDistr_cpp_huber_scale");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_huber_scale(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(epsilon)), Shield<SEXP>(Rcpp::wrap(proposal2)), Shield<SEXP>(Rcpp::wrap(maxit)), Shield<SEXP>(Rcpp::wrap(tol)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<double >(rcpp_result_gen);
+    }
+
+    inline Rcpp::List cpp_huber_irls(const NumericMatrix& X, const NumericVector& y, const double& epsilon = 1.345, const bool& proposal2 = false, const int& maxit = 50, const double& tol = 1e-6) {
+        typedef SEXP(*Ptr_cpp_huber_irls)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_huber_irls p_cpp_huber_irls = NULL;
+        if (p_cpp_huber_irls == NULL) {
+            validateSignature("Rcpp::List(*cpp_huber_irls)(const NumericMatrix&,const NumericVector&,const double&,const bool&,const int&,const double&)");
+            p_cpp_huber_irls = (Ptr_cpp_huber_irls)R_GetCCallable("extraDistr", "_extraDistr_cpp_huber_irls");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_huber_irls(Shield<SEXP>(Rcpp::wrap(X)), Shield<SEXP>(Rcpp::wrap(y)), Shield<SEXP>(Rcpp::wrap(epsilon)), Shield<SEXP>(Rcpp::wrap(proposal2)), Shield<SEXP>(Rcpp::wrap(maxit)), Shield<SEXP>(Rcpp::wrap(tol)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<Rcpp::List >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dinvgamma(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dinvgamma)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dinvgamma p_cpp_dinvgamma = NULL;
@@ -1935,17 +2712,38 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rkumar(const int& n, const NumericVector& a, const NumericVector& b) {
-        typedef SEXP(*Ptr_cpp_rkumar)(SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rkumar(const int& n, const NumericVector& a, const NumericVector& b, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rkumar)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rkumar p_cpp_rkumar = NULL;
         if (p_cpp_rkumar == NULL) {
-            validateSignature("NumericVector(*cpp_rkumar)(const int&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rkumar)(const int&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rkumar = (Ptr_cpp_rkumar)R_GetCCallable("extraDistr", "_extraDistr_cpp_rkumar");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rkumar(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)));
+            rcpp_result_gen = p_cpp_rkumar(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_kumar(const int& n, const NumericVector& size, const NumericVector& a, const NumericVector& b, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_kumar)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_kumar p_cpp_rextreme_kumar = NULL;
+        if (p_cpp_rextreme_kumar == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_kumar)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_kumar = (Ptr_cpp_rextreme_kumar)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_kumar");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_kumar(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(minimum)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -2218,7 +3016,91 @@ namespace extraDistr {
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_dlomax(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+            rcpp_result_gen = p_cpp_dlomax(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_plomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_plomax)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_plomax p_cpp_plomax = NULL;
+        if (p_cpp_plomax == NULL) {
+            validateSignature("NumericVector(*cpp_plomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_plomax = (Ptr_cpp_plomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_plomax");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_plomax(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_qlomax(const NumericVector& p, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qlomax)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qlomax p_cpp_qlomax = NULL;
+        if (p_cpp_qlomax == NULL) {
+            validateSignature("NumericVector(*cpp_qlomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qlomax = (Ptr_cpp_qlomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_qlomax");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qlomax(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rlomax(const int& n, const NumericVector& lambda, const NumericVector& kappa, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rlomax)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rlomax p_cpp_rlomax = NULL;
+        if (p_cpp_rlomax == NULL) {
+            validateSignature("NumericVector(*cpp_rlomax)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rlomax = (Ptr_cpp_rlomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_rlomax");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rlomax(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_lomax(const int& n, const NumericVector& size, const NumericVector& lambda, const NumericVector& kappa, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_lomax)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_lomax p_cpp_rextreme_lomax = NULL;
+        if (p_cpp_rextreme_lomax == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_lomax)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_lomax = (Ptr_cpp_rextreme_lomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_lomax");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_lomax(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(minimum)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -2229,17 +3111,17 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_plomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail = true, const bool& log_prob = false) {
-        typedef SEXP(*Ptr_cpp_plomax)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_cpp_plomax p_cpp_plomax = NULL;
-        if (p_cpp_plomax == NULL) {
-            validateSignature("NumericVector(*cpp_plomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-            p_cpp_plomax = (Ptr_cpp_plomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_plomax");
+    inline NumericVector cpp_plomax_interval(const NumericVector& a, const NumericVector& b, const NumericVector& lambda, const NumericVector& kappa, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_plomax_interval)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_plomax_interval p_cpp_plomax_interval = NULL;
+        if (p_cpp_plomax_interval == NULL) {
+            validateSignature("NumericVector(*cpp_plomax_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_plomax_interval = (Ptr_cpp_plomax_interval)R_GetCCallable("extraDistr", "_extraDistr_cpp_plomax_interval");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_plomax(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+            rcpp_result_gen = p_cpp_plomax_interval(Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -2250,17 +3132,17 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_qlomax(const NumericVector& p, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail = true, const bool& log_prob = false) {
-        typedef SEXP(*Ptr_cpp_qlomax)(SEXP,SEXP,SEXP,SEXP,SEXP);
-        static Ptr_cpp_qlomax p_cpp_qlomax = NULL;
-        if (p_cpp_qlomax == NULL) {
-            validateSignature("NumericVector(*cpp_qlomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-            p_cpp_qlomax = (Ptr_cpp_qlomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_qlomax");
+    inline NumericVector cpp_dcens_lomax(const NumericVector& x, const NumericVector& status, const NumericVector& lambda, const NumericVector& kappa, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_lomax)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_lomax p_cpp_dcens_lomax = NULL;
+        if (p_cpp_dcens_lomax == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_lomax)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_lomax = (Ptr_cpp_dcens_lomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_lomax");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_qlomax(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+            rcpp_result_gen = p_cpp_dcens_lomax(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -2271,17 +3153,17 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rlomax(const int& n, const NumericVector& lambda, const NumericVector& kappa) {
-        typedef SEXP(*Ptr_cpp_rlomax)(SEXP,SEXP,SEXP);
-        static Ptr_cpp_rlomax p_cpp_rlomax = NULL;
-        if (p_cpp_rlomax == NULL) {
-            validateSignature("NumericVector(*cpp_rlomax)(const int&,const NumericVector&,const NumericVector&)");
-            p_cpp_rlomax = (Ptr_cpp_rlomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_rlomax");
+    inline NumericVector cpp_hazard_lomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_lomax)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_lomax p_cpp_hazard_lomax = NULL;
+        if (p_cpp_hazard_lomax == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_lomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_lomax = (Ptr_cpp_hazard_lomax)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_lomax");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rlomax(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)));
+            rcpp_result_gen = p_cpp_hazard_lomax(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(kappa)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -2502,6 +3384,48 @@ namespace extraDistr {
         return Rcpp::as<NumericMatrix >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_dmvnorm(const NumericMatrix& x, const NumericMatrix& mu, const NumericVector& sigma, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dmvnorm)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dmvnorm p_cpp_dmvnorm = NULL;
+        if (p_cpp_dmvnorm == NULL) {
+            validateSignature("NumericVector(*cpp_dmvnorm)(const NumericMatrix&,const NumericMatrix&,const NumericVector&,const bool&)");
+            p_cpp_dmvnorm = (Ptr_cpp_dmvnorm)R_GetCCallable("extraDistr", "_extraDistr_cpp_dmvnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dmvnorm(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericMatrix cpp_rmvnorm(const int& n, const NumericMatrix& mu, const NumericVector& sigma) {
+        typedef SEXP(*Ptr_cpp_rmvnorm)(SEXP,SEXP,SEXP);
+        static Ptr_cpp_rmvnorm p_cpp_rmvnorm = NULL;
+        if (p_cpp_rmvnorm == NULL) {
+            validateSignature("NumericMatrix(*cpp_rmvnorm)(const int&,const NumericMatrix&,const NumericVector&)");
+            p_cpp_rmvnorm = (Ptr_cpp_rmvnorm)R_GetCCallable("extraDistr", "_extraDistr_cpp_rmvnorm");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rmvnorm(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericMatrix >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dnhyper)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dnhyper p_cpp_dnhyper = NULL;
@@ -2733,17 +3657,80 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rpareto(const int& n, const NumericVector& a, const NumericVector& b) {
-        typedef SEXP(*Ptr_cpp_rpareto)(SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rpareto(const int& n, const NumericVector& a, const NumericVector& b, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rpareto)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rpareto p_cpp_rpareto = NULL;
         if (p_cpp_rpareto == NULL) {
-            validateSignature("NumericVector(*cpp_rpareto)(const int&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rpareto)(const int&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rpareto = (Ptr_cpp_rpareto)R_GetCCallable("extraDistr", "_extraDistr_cpp_rpareto");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rpareto(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)));
+            rcpp_result_gen = p_cpp_rpareto(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_pareto(const int& n, const NumericVector& size, const NumericVector& a, const NumericVector& b, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_pareto)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_pareto p_cpp_rextreme_pareto = NULL;
+        if (p_cpp_rextreme_pareto == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_pareto)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_pareto = (Ptr_cpp_rextreme_pareto)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_pareto");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_pareto(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(minimum)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dcens_pareto(const NumericVector& x, const NumericVector& status, const NumericVector& a, const NumericVector& b, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_pareto)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_pareto p_cpp_dcens_pareto = NULL;
+        if (p_cpp_dcens_pareto == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_pareto)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_pareto = (Ptr_cpp_dcens_pareto)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_pareto");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_pareto(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_hazard_pareto(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_pareto)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_pareto p_cpp_hazard_pareto = NULL;
+        if (p_cpp_hazard_pareto == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_pareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_pareto = (Ptr_cpp_hazard_pareto)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_pareto");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_pareto(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(a)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -2817,17 +3804,38 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rpower(const int& n, const NumericVector& alpha, const NumericVector& beta) {
-        typedef SEXP(*Ptr_cpp_rpower)(SEXP,SEXP,SEXP);
+    inline NumericVector cpp_rpower(const int& n, const NumericVector& alpha, const NumericVector& beta, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rpower)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_rpower p_cpp_rpower = NULL;
         if (p_cpp_rpower == NULL) {
-            validateSignature("NumericVector(*cpp_rpower)(const int&,const NumericVector&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rpower)(const int&,const NumericVector&,const NumericVector&,const bool&)");
             p_cpp_rpower = (Ptr_cpp_rpower)R_GetCCallable("extraDistr", "_extraDistr_cpp_rpower");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rpower(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)));
+            rcpp_result_gen = p_cpp_rpower(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_power(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_power)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_power p_cpp_rextreme_power = NULL;
+        if (p_cpp_rextreme_power == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_power)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_power = (Ptr_cpp_rextreme_power)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_power");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_power(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(alpha)), Shield<SEXP>(Rcpp::wrap(beta)), Shield<SEXP>(Rcpp::wrap(minimum)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -2922,6 +3930,48 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qapprox_cheb(const NumericVector& p, const NumericVector& breaks, const NumericMatrix& coefs, const IntegerVector& guide, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qapprox_cheb)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qapprox_cheb p_cpp_qapprox_cheb = NULL;
+        if (p_cpp_qapprox_cheb == NULL) {
+            validateSignature("NumericVector(*cpp_qapprox_cheb)(const NumericVector&,const NumericVector&,const NumericMatrix&,const IntegerVector&,const bool&,const bool&)");
+            p_cpp_qapprox_cheb = (Ptr_cpp_qapprox_cheb)R_GetCCallable("extraDistr", "_extraDistr_cpp_qapprox_cheb");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qapprox_cheb(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(breaks)), Shield<SEXP>(Rcpp::wrap(coefs)), Shield<SEXP>(Rcpp::wrap(guide)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_qapprox_disc(const NumericVector& p, const NumericVector& cdf, const double& x0, const double& lo, const double& hi, const IntegerVector& guide, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qapprox_disc)(SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qapprox_disc p_cpp_qapprox_disc = NULL;
+        if (p_cpp_qapprox_disc == NULL) {
+            validateSignature("NumericVector(*cpp_qapprox_disc)(const NumericVector&,const NumericVector&,const double&,const double&,const double&,const IntegerVector&,const bool&,const bool&)");
+            p_cpp_qapprox_disc = (Ptr_cpp_qapprox_disc)R_GetCCallable("extraDistr", "_extraDistr_cpp_qapprox_disc");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qapprox_disc(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(cdf)), Shield<SEXP>(Rcpp::wrap(x0)), Shield<SEXP>(Rcpp::wrap(lo)), Shield<SEXP>(Rcpp::wrap(hi)), Shield<SEXP>(Rcpp::wrap(guide)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rsign(const int& n) {
         typedef SEXP(*Ptr_cpp_rsign)(SEXP);
         static Ptr_cpp_rsign p_cpp_rsign = NULL;
@@ -3006,17 +4056,59 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rrayleigh(const int& n, const NumericVector& sigma) {
-        typedef SEXP(*Ptr_cpp_rrayleigh)(SEXP,SEXP);
+    inline NumericVector cpp_rrayleigh(const int& n, const NumericVector& sigma, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rrayleigh)(SEXP,SEXP,SEXP);
         static Ptr_cpp_rrayleigh p_cpp_rrayleigh = NULL;
         if (p_cpp_rrayleigh == NULL) {
-            validateSignature("NumericVector(*cpp_rrayleigh)(const int&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rrayleigh)(const int&,const NumericVector&,const bool&)");
             p_cpp_rrayleigh = (Ptr_cpp_rrayleigh)R_GetCCallable("extraDistr", "_extraDistr_cpp_rrayleigh");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rrayleigh(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(sigma)));
+            rcpp_result_gen = p_cpp_rrayleigh(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_rayleigh(const int& n, const NumericVector& size, const NumericVector& sigma, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_rayleigh)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_rayleigh p_cpp_rextreme_rayleigh = NULL;
+        if (p_cpp_rextreme_rayleigh == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_rayleigh)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_rayleigh = (Ptr_cpp_rextreme_rayleigh)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_rayleigh");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_rayleigh(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(minimum)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_dcens_rayleigh(const NumericVector& x, const NumericVector& status, const NumericVector& sigma, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_rayleigh)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_rayleigh p_cpp_dcens_rayleigh = NULL;
+        if (p_cpp_dcens_rayleigh == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_rayleigh)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_rayleigh = (Ptr_cpp_dcens_rayleigh)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_rayleigh");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_rayleigh(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(log_prob)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -3069,6 +4161,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qsgomp(const NumericVector& p, const NumericVector& b, const NumericVector& eta, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qsgomp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qsgomp p_cpp_qsgomp = NULL;
+        if (p_cpp_qsgomp == NULL) {
+            validateSignature("NumericVector(*cpp_qsgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qsgomp = (Ptr_cpp_qsgomp)R_GetCCallable("extraDistr", "_extraDistr_cpp_qsgomp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qsgomp(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(eta)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rsgomp(const int& n, const NumericVector& b, const NumericVector& eta) {
         typedef SEXP(*Ptr_cpp_rsgomp)(SEXP,SEXP,SEXP);
         static Ptr_cpp_rsgomp p_cpp_rsgomp = NULL;
@@ -3090,6 +4203,48 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_dcens_sgomp(const NumericVector& x, const NumericVector& status, const NumericVector& b, const NumericVector& eta, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_sgomp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_sgomp p_cpp_dcens_sgomp = NULL;
+        if (p_cpp_dcens_sgomp == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_sgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_sgomp = (Ptr_cpp_dcens_sgomp)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_sgomp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_sgomp(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(eta)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_hazard_sgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, const bool& cumulative = false, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_hazard_sgomp)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_hazard_sgomp p_cpp_hazard_sgomp = NULL;
+        if (p_cpp_hazard_sgomp == NULL) {
+            validateSignature("NumericVector(*cpp_hazard_sgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_hazard_sgomp = (Ptr_cpp_hazard_sgomp)R_GetCCallable("extraDistr", "_extraDistr_cpp_hazard_sgomp");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_hazard_sgomp(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(b)), Shield<SEXP>(Rcpp::wrap(eta)), Shield<SEXP>(Rcpp::wrap(cumulative)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dskellam(const NumericVector& x, const NumericVector& mu1, const NumericVector& mu2, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dskellam)(SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dskellam p_cpp_dskellam = NULL;
@@ -3174,6 +4329,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qslash(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qslash)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qslash p_cpp_qslash = NULL;
+        if (p_cpp_qslash == NULL) {
+            validateSignature("NumericVector(*cpp_qslash)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qslash = (Ptr_cpp_qslash)R_GetCCallable("extraDistr", "_extraDistr_cpp_qslash");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qslash(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(sigma)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rslash(const int& n, const NumericVector& mu, const NumericVector& sigma) {
         typedef SEXP(*Ptr_cpp_rslash)(SEXP,SEXP,SEXP);
         static Ptr_cpp_rslash p_cpp_rslash = NULL;
@@ -3552,17 +4728,38 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
-    inline NumericVector cpp_rtlambda(const int& n, const NumericVector& lambda) {
-        typedef SEXP(*Ptr_cpp_rtlambda)(SEXP,SEXP);
+    inline NumericVector cpp_rtlambda(const int& n, const NumericVector& lambda, const bool& sorted = false) {
+        typedef SEXP(*Ptr_cpp_rtlambda)(SEXP,SEXP,SEXP);
         static Ptr_cpp_rtlambda p_cpp_rtlambda = NULL;
         if (p_cpp_rtlambda == NULL) {
-            validateSignature("NumericVector(*cpp_rtlambda)(const int&,const NumericVector&)");
+            validateSignature("NumericVector(*cpp_rtlambda)(const int&,const NumericVector&,const bool&)");
             p_cpp_rtlambda = (Ptr_cpp_rtlambda)R_GetCCallable("extraDistr", "_extraDistr_cpp_rtlambda");
         }
         RObject rcpp_result_gen;
         {
             RNGScope RCPP_rngScope_gen;
-            rcpp_result_gen = p_cpp_rtlambda(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lambda)));
+            rcpp_result_gen = p_cpp_rtlambda(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(sorted)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
+    inline NumericVector cpp_rextreme_tlambda(const int& n, const NumericVector& size, const NumericVector& lambda, const bool& minimum = false) {
+        typedef SEXP(*Ptr_cpp_rextreme_tlambda)(SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_rextreme_tlambda p_cpp_rextreme_tlambda = NULL;
+        if (p_cpp_rextreme_tlambda == NULL) {
+            validateSignature("NumericVector(*cpp_rextreme_tlambda)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_rextreme_tlambda = (Ptr_cpp_rextreme_tlambda)R_GetCCallable("extraDistr", "_extraDistr_cpp_rextreme_tlambda");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_rextreme_tlambda(Shield<SEXP>(Rcpp::wrap(n)), Shield<SEXP>(Rcpp::wrap(size)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(minimum)));
         }
         if (rcpp_result_gen.inherits("interrupted-error"))
             throw Rcpp::internal::InterruptedException();
@@ -3615,6 +4812,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_qwald(const NumericVector& p, const NumericVector& mu, const NumericVector& lambda, const bool& lower_tail = true, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_qwald)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_qwald p_cpp_qwald = NULL;
+        if (p_cpp_qwald == NULL) {
+            validateSignature("NumericVector(*cpp_qwald)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+            p_cpp_qwald = (Ptr_cpp_qwald)R_GetCCallable("extraDistr", "_extraDistr_cpp_qwald");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_qwald(Shield<SEXP>(Rcpp::wrap(p)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(lower_tail)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_rwald(const int& n, const NumericVector& mu, const NumericVector& lambda) {
         typedef SEXP(*Ptr_cpp_rwald)(SEXP,SEXP,SEXP);
         static Ptr_cpp_rwald p_cpp_rwald = NULL;
@@ -3636,6 +4854,27 @@ namespace extraDistr {
         return Rcpp::as<NumericVector >(rcpp_result_gen);
     }
 
+    inline NumericVector cpp_dcens_wald(const NumericVector& x, const NumericVector& status, const NumericVector& mu, const NumericVector& lambda, const bool& log_prob = false) {
+        typedef SEXP(*Ptr_cpp_dcens_wald)(SEXP,SEXP,SEXP,SEXP,SEXP);
+        static Ptr_cpp_dcens_wald p_cpp_dcens_wald = NULL;
+        if (p_cpp_dcens_wald == NULL) {
+            validateSignature("NumericVector(*cpp_dcens_wald)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+            p_cpp_dcens_wald = (Ptr_cpp_dcens_wald)R_GetCCallable("extraDistr", "_extraDistr_cpp_dcens_wald");
+        }
+        RObject rcpp_result_gen;
+        {
+            RNGScope RCPP_rngScope_gen;
+            rcpp_result_gen = p_cpp_dcens_wald(Shield<SEXP>(Rcpp::wrap(x)), Shield<SEXP>(Rcpp::wrap(status)), Shield<SEXP>(Rcpp::wrap(mu)), Shield<SEXP>(Rcpp::wrap(lambda)), Shield<SEXP>(Rcpp::wrap(log_prob)));
+        }
+        if (rcpp_result_gen.inherits("interrupted-error"))
+            throw Rcpp::internal::InterruptedException();
+        if (Rcpp::internal::isLongjumpSentinel(rcpp_result_gen))
+            throw Rcpp::LongjumpException(rcpp_result_gen);
+        if (rcpp_result_gen.inherits("try-error"))
+            throw Rcpp::exception(Rcpp::as<std::string>(rcpp_result_gen).c_str());
+        return Rcpp::as<NumericVector >(rcpp_result_gen);
+    }
+
     inline NumericVector cpp_dzib(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& log_prob = false) {
         typedef SEXP(*Ptr_cpp_dzib)(SEXP,SEXP,SEXP,SEXP,SEXP);
         static Ptr_cpp_dzib p_cpp_dzib = NULL;
@@ -616,6 +616,45 @@ RcppExport SEXP _extraDistr_cpp_pbhatt(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_qbhatt
+NumericVector cpp_qbhatt(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& a, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qbhatt_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP aSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qbhatt(p, mu, sigma, a, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qbhatt(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP aSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qbhatt_try(pSEXP, muSEXP, sigmaSEXP, aSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_rbhatt
 NumericVector cpp_rbhatt(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& a);
 static SEXP _extraDistr_cpp_rbhatt_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP aSEXP) {
@@ -806,6 +845,84 @@ RcppExport SEXP _extraDistr_cpp_rfatigue(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_dcens_fatigue
+NumericVector cpp_dcens_fatigue(const NumericVector& x, const NumericVector& status, const NumericVector& alpha, const NumericVector& beta, const NumericVector& mu, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_fatigue_try(SEXP xSEXP, SEXP statusSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP muSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_fatigue(x, status, alpha, beta, mu, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dcens_fatigue(SEXP xSEXP, SEXP statusSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP muSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_fatigue_try(xSEXP, statusSEXP, alphaSEXP, betaSEXP, muSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_hazard_fatigue
+NumericVector cpp_hazard_fatigue(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const NumericVector& mu, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_fatigue_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP muSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_fatigue(x, alpha, beta, mu, cumulative, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_hazard_fatigue(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP muSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_fatigue_try(xSEXP, alphaSEXP, betaSEXP, muSEXP, cumulativeSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_dbnorm
 NumericVector cpp_dbnorm(const NumericVector& x, const NumericVector& y, const NumericVector& mu1, const NumericVector& mu2, const NumericVector& sigma1, const NumericVector& sigma2, const NumericVector& rho, const bool& log_prob);
 static SEXP _extraDistr_cpp_dbnorm_try(SEXP xSEXP, SEXP ySEXP, SEXP mu1SEXP, SEXP mu2SEXP, SEXP sigma1SEXP, SEXP sigma2SEXP, SEXP rhoSEXP, SEXP log_probSEXP) {
@@ -1142,6 +1259,44 @@ RcppExport SEXP _extraDistr_cpp_rcat(SEXP nSEXP, SEXP probSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_rcopula
+NumericMatrix cpp_rcopula(const int& n, const NumericMatrix& corr, const CharacterVector& family, const NumericMatrix& theta, const double& df);
+static SEXP _extraDistr_cpp_rcopula_try(SEXP nSEXP, SEXP corrSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP dfSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type corr(corrSEXP);
+    Rcpp::traits::input_parameter< const CharacterVector& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const double& >::type df(dfSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rcopula(n, corr, family, theta, df));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rcopula(SEXP nSEXP, SEXP corrSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP dfSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rcopula_try(nSEXP, corrSEXP, familySEXP, thetaSEXP, dfSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_ddirichlet
 NumericVector cpp_ddirichlet(const NumericMatrix& x, const NumericMatrix& alpha, const bool& log_prob);
 static SEXP _extraDistr_cpp_ddirichlet_try(SEXP xSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
@@ -1323,6 +1478,118 @@ RcppExport SEXP _extraDistr_cpp_ddgamma(SEXP xSEXP, SEXP shapeSEXP, SEXP scaleSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_pdgamma
+NumericVector cpp_pdgamma(const NumericVector& x, const NumericVector& shape, const NumericVector& scale, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pdgamma_try(SEXP xSEXP, SEXP shapeSEXP, SEXP scaleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type shape(shapeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pdgamma(x, shape, scale, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pdgamma(SEXP xSEXP, SEXP shapeSEXP, SEXP scaleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pdgamma_try(xSEXP, shapeSEXP, scaleSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qdgamma
+NumericVector cpp_qdgamma(const NumericVector& p, const NumericVector& shape, const NumericVector& scale, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qdgamma_try(SEXP pSEXP, SEXP shapeSEXP, SEXP scaleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type shape(shapeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qdgamma(p, shape, scale, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qdgamma(SEXP pSEXP, SEXP shapeSEXP, SEXP scaleSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qdgamma_try(pSEXP, shapeSEXP, scaleSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rdgamma
+NumericVector cpp_rdgamma(const int& n, const NumericVector& shape, const NumericVector& scale);
+static SEXP _extraDistr_cpp_rdgamma_try(SEXP nSEXP, SEXP shapeSEXP, SEXP scaleSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type shape(shapeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type scale(scaleSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rdgamma(n, shape, scale));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rdgamma(SEXP nSEXP, SEXP shapeSEXP, SEXP scaleSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rdgamma_try(nSEXP, shapeSEXP, scaleSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_ddlaplace
 NumericVector cpp_ddlaplace(const NumericVector& x, const NumericVector& location, const NumericVector& scale, const bool& log_prob);
 static SEXP _extraDistr_cpp_ddlaplace_try(SEXP xSEXP, SEXP locationSEXP, SEXP scaleSEXP, SEXP log_probSEXP) {
@@ -1734,22 +2001,23 @@ RcppExport SEXP _extraDistr_cpp_qdweibull(SEXP pSEXP, SEXP qSEXP, SEXP betaSEXP,
     return rcpp_result_gen;
 }
 // cpp_rdweibull
-NumericVector cpp_rdweibull(const int& n, const NumericVector& q, const NumericVector& beta);
-static SEXP _extraDistr_cpp_rdweibull_try(SEXP nSEXP, SEXP qSEXP, SEXP betaSEXP) {
+NumericVector cpp_rdweibull(const int& n, const NumericVector& q, const NumericVector& beta, const bool& sorted);
+static SEXP _extraDistr_cpp_rdweibull_try(SEXP nSEXP, SEXP qSEXP, SEXP betaSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type q(qSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rdweibull(n, q, beta));
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rdweibull(n, q, beta, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rdweibull(SEXP nSEXP, SEXP qSEXP, SEXP betaSEXP) {
+RcppExport SEXP _extraDistr_cpp_rdweibull(SEXP nSEXP, SEXP qSEXP, SEXP betaSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rdweibull_try(nSEXP, qSEXP, betaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rdweibull_try(nSEXP, qSEXP, betaSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1769,25 +2037,25 @@ RcppExport SEXP _extraDistr_cpp_rdweibull(SEXP nSEXP, SEXP qSEXP, SEXP betaSEXP)
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dfrechet
-NumericVector cpp_dfrechet(const NumericVector& x, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_dfrechet_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_dcens_dweibull
+NumericVector cpp_dcens_dweibull(const NumericVector& x, const NumericVector& status, const NumericVector& q, const NumericVector& beta, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_dweibull_try(SEXP xSEXP, SEXP statusSEXP, SEXP qSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type q(qSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dfrechet(x, lambda, mu, sigma, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_dweibull(x, status, q, beta, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dfrechet(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dcens_dweibull(SEXP xSEXP, SEXP statusSEXP, SEXP qSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dfrechet_try(xSEXP, lambdaSEXP, muSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_dweibull_try(xSEXP, statusSEXP, qSEXP, betaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1807,26 +2075,25 @@ RcppExport SEXP _extraDistr_cpp_dfrechet(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pfrechet
-NumericVector cpp_pfrechet(const NumericVector& x, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pfrechet_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dmix
+NumericVector cpp_dmix(const NumericVector& x, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha, const bool& log_prob);
+static SEXP _extraDistr_cpp_dmix_try(SEXP xSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const CharacterVector& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pfrechet(x, lambda, mu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dmix(x, family, theta, alpha, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pfrechet(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dmix(SEXP xSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pfrechet_try(xSEXP, lambdaSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmix_try(xSEXP, familySEXP, thetaSEXP, alphaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1846,26 +2113,26 @@ RcppExport SEXP _extraDistr_cpp_pfrechet(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qfrechet
-NumericVector cpp_qfrechet(const NumericVector& p, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qfrechet_try(SEXP pSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pmix
+NumericVector cpp_pmix(const NumericVector& x, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pmix_try(SEXP xSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const CharacterVector& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qfrechet(p, lambda, mu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pmix(x, family, theta, alpha, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qfrechet(SEXP pSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pmix(SEXP xSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qfrechet_try(pSEXP, lambdaSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pmix_try(xSEXP, familySEXP, thetaSEXP, alphaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1885,24 +2152,26 @@ RcppExport SEXP _extraDistr_cpp_qfrechet(SEXP pSEXP, SEXP lambdaSEXP, SEXP muSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rfrechet
-NumericVector cpp_rfrechet(const int& n, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rfrechet_try(SEXP nSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+// cpp_qmix
+NumericVector cpp_qmix(const NumericVector& p, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qmix_try(SEXP pSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rfrechet(n, lambda, mu, sigma));
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const CharacterVector& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qmix(p, family, theta, alpha, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rfrechet(SEXP nSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_qmix(SEXP pSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rfrechet_try(nSEXP, lambdaSEXP, muSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qmix_try(pSEXP, familySEXP, thetaSEXP, alphaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1922,24 +2191,24 @@ RcppExport SEXP _extraDistr_cpp_rfrechet(SEXP nSEXP, SEXP lambdaSEXP, SEXP muSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgpois
-NumericVector cpp_dgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
-static SEXP _extraDistr_cpp_dgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+// cpp_rmix
+NumericVector cpp_rmix(const int& n, const CharacterVector& family, const NumericMatrix& theta, const NumericVector& alpha);
+static SEXP _extraDistr_cpp_rmix_try(SEXP nSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const CharacterVector& >::type family(familySEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type theta(thetaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgpois(x, alpha, beta, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_rmix(n, family, theta, alpha));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rmix(SEXP nSEXP, SEXP familySEXP, SEXP thetaSEXP, SEXP alphaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpois_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmix_try(nSEXP, familySEXP, thetaSEXP, alphaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1959,25 +2228,25 @@ RcppExport SEXP _extraDistr_cpp_dgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgpois
-NumericVector cpp_pgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dfrechet
+NumericVector cpp_dfrechet(const NumericVector& x, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dfrechet_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgpois(x, alpha, beta, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dfrechet(x, lambda, mu, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dfrechet(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpois_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dfrechet_try(xSEXP, lambdaSEXP, muSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -1997,23 +2266,26 @@ RcppExport SEXP _extraDistr_cpp_pgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgpois
-NumericVector cpp_rgpois(const int& n, const NumericVector& alpha, const NumericVector& beta);
-static SEXP _extraDistr_cpp_rgpois_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+// cpp_pfrechet
+NumericVector cpp_pfrechet(const NumericVector& x, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pfrechet_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgpois(n, alpha, beta));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pfrechet(x, lambda, mu, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgpois(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+RcppExport SEXP _extraDistr_cpp_pfrechet(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgpois_try(nSEXP, alphaSEXP, betaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pfrechet_try(xSEXP, lambdaSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2033,25 +2305,26 @@ RcppExport SEXP _extraDistr_cpp_rgpois(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgev
-NumericVector cpp_dgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
-static SEXP _extraDistr_cpp_dgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+// cpp_qfrechet
+NumericVector cpp_qfrechet(const NumericVector& p, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qfrechet_try(SEXP pSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgev(x, mu, sigma, xi, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qfrechet(p, lambda, mu, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qfrechet(SEXP pSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qfrechet_try(pSEXP, lambdaSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2071,26 +2344,25 @@ RcppExport SEXP _extraDistr_cpp_dgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgev
-NumericVector cpp_pgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
-static SEXP _extraDistr_cpp_pgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rfrechet
+NumericVector cpp_rfrechet(const int& n, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& sorted);
+static SEXP _extraDistr_cpp_rfrechet_try(SEXP nSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgev(x, mu, sigma, xi, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rfrechet(n, lambda, mu, sigma, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rfrechet(SEXP nSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rfrechet_try(nSEXP, lambdaSEXP, muSEXP, sigmaSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2110,26 +2382,26 @@ RcppExport SEXP _extraDistr_cpp_pgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qgev
-NumericVector cpp_qgev(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
-static SEXP _extraDistr_cpp_qgev_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rextreme_frechet
+NumericVector cpp_rextreme_frechet(const int& n, const NumericVector& size, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_frechet_try(SEXP nSEXP, SEXP sizeSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qgev(p, mu, sigma, xi, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_frechet(n, size, lambda, mu, sigma, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qgev(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_frechet(SEXP nSEXP, SEXP sizeSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgev_try(pSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_frechet_try(nSEXP, sizeSEXP, lambdaSEXP, muSEXP, sigmaSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2149,24 +2421,26 @@ RcppExport SEXP _extraDistr_cpp_qgev(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgev
-NumericVector cpp_rgev(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi);
-static SEXP _extraDistr_cpp_rgev_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+// cpp_pfrechet_interval
+NumericVector cpp_pfrechet_interval(const NumericVector& a, const NumericVector& b, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_pfrechet_interval_try(SEXP aSEXP, SEXP bSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgev(n, mu, sigma, xi));
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pfrechet_interval(a, b, lambda, mu, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgev(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+RcppExport SEXP _extraDistr_cpp_pfrechet_interval(SEXP aSEXP, SEXP bSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgev_try(nSEXP, muSEXP, sigmaSEXP, xiSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pfrechet_interval_try(aSEXP, bSEXP, lambdaSEXP, muSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2186,24 +2460,26 @@ RcppExport SEXP _extraDistr_cpp_rgev(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgompertz
-NumericVector cpp_dgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, bool log_prob);
-static SEXP _extraDistr_cpp_dgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+// cpp_dcens_frechet
+NumericVector cpp_dcens_frechet(const NumericVector& x, const NumericVector& status, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_frechet_try(SEXP xSEXP, SEXP statusSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgompertz(x, a, b, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_frechet(x, status, lambda, mu, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dcens_frechet(SEXP xSEXP, SEXP statusSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgompertz_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_frechet_try(xSEXP, statusSEXP, lambdaSEXP, muSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2223,25 +2499,26 @@ RcppExport SEXP _extraDistr_cpp_dgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgompertz
-NumericVector cpp_pgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_hazard_frechet
+NumericVector cpp_hazard_frechet(const NumericVector& x, const NumericVector& lambda, const NumericVector& mu, const NumericVector& sigma, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_frechet_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgompertz(x, a, b, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_frechet(x, lambda, mu, sigma, cumulative, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_hazard_frechet(SEXP xSEXP, SEXP lambdaSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgompertz_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_frechet_try(xSEXP, lambdaSEXP, muSEXP, sigmaSEXP, cumulativeSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2261,25 +2538,24 @@ RcppExport SEXP _extraDistr_cpp_pgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qgompertz
-NumericVector cpp_qgompertz(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qgompertz_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dgpois
+NumericVector cpp_dgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qgompertz(p, a, b, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dgpois(x, alpha, beta, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qgompertz(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgompertz_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpois_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2299,23 +2575,25 @@ RcppExport SEXP _extraDistr_cpp_qgompertz(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgompertz
-NumericVector cpp_rgompertz(const int& n, const NumericVector& a, const NumericVector& b);
-static SEXP _extraDistr_cpp_rgompertz_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+// cpp_pgpois
+NumericVector cpp_pgpois(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgpois_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgompertz(n, a, b));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pgpois(x, alpha, beta, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgompertz(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgpois(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgompertz_try(nSEXP, aSEXP, bSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpois_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2335,25 +2613,23 @@ RcppExport SEXP _extraDistr_cpp_rgompertz(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgpd
-NumericVector cpp_dgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
-static SEXP _extraDistr_cpp_dgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+// cpp_rgpois
+NumericVector cpp_rgpois(const int& n, const NumericVector& alpha, const NumericVector& beta);
+static SEXP _extraDistr_cpp_rgpois_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgpd(x, mu, sigma, xi, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgpois(n, alpha, beta));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rgpois(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgpois_try(nSEXP, alphaSEXP, betaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2373,26 +2649,25 @@ RcppExport SEXP _extraDistr_cpp_dgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgpd
-NumericVector cpp_pgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dgev
+NumericVector cpp_dgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgpd(x, mu, sigma, xi, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dgev(x, mu, sigma, xi, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2412,26 +2687,26 @@ RcppExport SEXP _extraDistr_cpp_pgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qgpd
-NumericVector cpp_qgpd(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qgpd_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pgev
+NumericVector cpp_pgev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
+static SEXP _extraDistr_cpp_pgev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qgpd(p, mu, sigma, xi, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pgev(x, mu, sigma, xi, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qgpd(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgpd_try(pSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2451,24 +2726,26 @@ RcppExport SEXP _extraDistr_cpp_qgpd(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgpd
-NumericVector cpp_rgpd(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi);
-static SEXP _extraDistr_cpp_rgpd_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+// cpp_qgev
+NumericVector cpp_qgev(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, bool lower_tail, bool log_prob);
+static SEXP _extraDistr_cpp_qgev_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgpd(n, mu, sigma, xi));
+    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qgev(p, mu, sigma, xi, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgpd(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP) {
+RcppExport SEXP _extraDistr_cpp_qgev(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgpd_try(nSEXP, muSEXP, sigmaSEXP, xiSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgev_try(pSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2488,24 +2765,25 @@ RcppExport SEXP _extraDistr_cpp_rgpd(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dgumbel
-NumericVector cpp_dgumbel(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_dgumbel_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_rgev
+NumericVector cpp_rgev(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& sorted);
+static SEXP _extraDistr_cpp_rgev_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dgumbel(x, mu, sigma, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgev(n, mu, sigma, xi, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dgumbel(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rgev(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgumbel_try(xSEXP, muSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgev_try(nSEXP, muSEXP, sigmaSEXP, xiSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2525,25 +2803,26 @@ RcppExport SEXP _extraDistr_cpp_dgumbel(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pgumbel
-NumericVector cpp_pgumbel(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pgumbel_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rextreme_gev
+NumericVector cpp_rextreme_gev(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_gev_try(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pgumbel(x, mu, sigma, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_gev(n, size, mu, sigma, xi, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pgumbel(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_gev(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgumbel_try(xSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_gev_try(nSEXP, sizeSEXP, muSEXP, sigmaSEXP, xiSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2563,25 +2842,25 @@ RcppExport SEXP _extraDistr_cpp_pgumbel(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qgumbel
-NumericVector cpp_qgumbel(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qgumbel_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dgev_outer
+NumericMatrix cpp_dgev_outer(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgev_outer_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qgumbel(p, mu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dgev_outer(x, mu, sigma, xi, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qgumbel(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgev_outer(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgumbel_try(pSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgev_outer_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2601,23 +2880,26 @@ RcppExport SEXP _extraDistr_cpp_qgumbel(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rgumbel
-NumericVector cpp_rgumbel(const int& n, const NumericVector& mu, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rgumbel_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+// cpp_pgev_outer
+NumericMatrix cpp_pgev_outer(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgev_outer_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rgumbel(n, mu, sigma));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pgev_outer(x, mu, sigma, xi, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rgumbel(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgev_outer(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgumbel_try(nSEXP, muSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgev_outer_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2637,23 +2919,26 @@ RcppExport SEXP _extraDistr_cpp_rgumbel(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP)
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dhcauchy
-NumericVector cpp_dhcauchy(const NumericVector& x, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_dhcauchy_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_pgev_interval
+NumericVector cpp_pgev_interval(const NumericVector& a, const NumericVector& b, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgev_interval_try(SEXP aSEXP, SEXP bSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dhcauchy(x, sigma, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pgev_interval(a, b, mu, sigma, xi, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dhcauchy(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgev_interval(SEXP aSEXP, SEXP bSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dhcauchy_try(xSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgev_interval_try(aSEXP, bSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2673,24 +2958,26 @@ RcppExport SEXP _extraDistr_cpp_dhcauchy(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_pr
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_phcauchy
-NumericVector cpp_phcauchy(const NumericVector& x, const NumericVector& sigma, bool lower_tail, bool log_prob);
-static SEXP _extraDistr_cpp_phcauchy_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_hazard_gev
+NumericVector cpp_hazard_gev(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_gev_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_phcauchy(x, sigma, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_gev(x, mu, sigma, xi, cumulative, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_phcauchy(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_hazard_gev(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_phcauchy_try(xSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_gev_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, cumulativeSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2710,24 +2997,24 @@ RcppExport SEXP _extraDistr_cpp_phcauchy(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qhcauchy
-NumericVector cpp_qhcauchy(const NumericVector& p, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qhcauchy_try(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dgompertz
+NumericVector cpp_dgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, bool log_prob);
+static SEXP _extraDistr_cpp_dgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qhcauchy(p, sigma, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dgompertz(x, a, b, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qhcauchy(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qhcauchy_try(pSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgompertz_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2747,22 +3034,25 @@ RcppExport SEXP _extraDistr_cpp_qhcauchy(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rhcauchy
-NumericVector cpp_rhcauchy(const int& n, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rhcauchy_try(SEXP nSEXP, SEXP sigmaSEXP) {
+// cpp_pgompertz
+NumericVector cpp_pgompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rhcauchy(n, sigma));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pgompertz(x, a, b, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rhcauchy(SEXP nSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rhcauchy_try(nSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgompertz_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2782,23 +3072,25 @@ RcppExport SEXP _extraDistr_cpp_rhcauchy(SEXP nSEXP, SEXP sigmaSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dhnorm
-NumericVector cpp_dhnorm(const NumericVector& x, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_dhnorm_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_qgompertz
+NumericVector cpp_qgompertz(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qgompertz_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dhnorm(x, sigma, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qgompertz(p, a, b, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dhnorm(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qgompertz(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dhnorm_try(xSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgompertz_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2818,24 +3110,24 @@ RcppExport SEXP _extraDistr_cpp_dhnorm(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_prob
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_phnorm
-NumericVector cpp_phnorm(const NumericVector& x, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_phnorm_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rgompertz
+NumericVector cpp_rgompertz(const int& n, const NumericVector& a, const NumericVector& b, const bool& sorted);
+static SEXP _extraDistr_cpp_rgompertz_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_phnorm(x, sigma, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgompertz(n, a, b, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_phnorm(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rgompertz(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_phnorm_try(xSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgompertz_try(nSEXP, aSEXP, bSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2855,24 +3147,25 @@ RcppExport SEXP _extraDistr_cpp_phnorm(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_ta
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qhnorm
-NumericVector cpp_qhnorm(const NumericVector& p, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qhnorm_try(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rextreme_gompertz
+NumericVector cpp_rextreme_gompertz(const int& n, const NumericVector& size, const NumericVector& a, const NumericVector& b, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_gompertz_try(SEXP nSEXP, SEXP sizeSEXP, SEXP aSEXP, SEXP bSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qhnorm(p, sigma, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_gompertz(n, size, a, b, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qhnorm(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_gompertz(SEXP nSEXP, SEXP sizeSEXP, SEXP aSEXP, SEXP bSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qhnorm_try(pSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_gompertz_try(nSEXP, sizeSEXP, aSEXP, bSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2892,22 +3185,25 @@ RcppExport SEXP _extraDistr_cpp_qhnorm(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_ta
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rhnorm
-NumericVector cpp_rhnorm(const int& n, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rhnorm_try(SEXP nSEXP, SEXP sigmaSEXP) {
+// cpp_dcens_gompertz
+NumericVector cpp_dcens_gompertz(const NumericVector& x, const NumericVector& status, const NumericVector& a, const NumericVector& b, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_gompertz_try(SEXP xSEXP, SEXP statusSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rhnorm(n, sigma));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_gompertz(x, status, a, b, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rhnorm(SEXP nSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_dcens_gompertz(SEXP xSEXP, SEXP statusSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rhnorm_try(nSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_gompertz_try(xSEXP, statusSEXP, aSEXP, bSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2927,24 +3223,25 @@ RcppExport SEXP _extraDistr_cpp_rhnorm(SEXP nSEXP, SEXP sigmaSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dht
-NumericVector cpp_dht(const NumericVector& x, const NumericVector& nu, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_dht_try(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_hazard_gompertz
+NumericVector cpp_hazard_gompertz(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_gompertz_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dht(x, nu, sigma, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_gompertz(x, a, b, cumulative, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dht(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_hazard_gompertz(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dht_try(xSEXP, nuSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_gompertz_try(xSEXP, aSEXP, bSEXP, cumulativeSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -2964,25 +3261,25 @@ RcppExport SEXP _extraDistr_cpp_dht(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pht
-NumericVector cpp_pht(const NumericVector& x, const NumericVector& nu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pht_try(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dgpd
+NumericVector cpp_dgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pht(x, nu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dgpd(x, mu, sigma, xi, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pht(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pht_try(xSEXP, nuSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3002,25 +3299,26 @@ RcppExport SEXP _extraDistr_cpp_pht(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qht
-NumericVector cpp_qht(const NumericVector& p, const NumericVector& nu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qht_try(SEXP pSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pgpd
+NumericVector cpp_pgpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qht(p, nu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pgpd(x, mu, sigma, xi, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qht(SEXP pSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qht_try(pSEXP, nuSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3040,23 +3338,26 @@ RcppExport SEXP _extraDistr_cpp_qht(SEXP pSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rht
-NumericVector cpp_rht(const int& n, const NumericVector& nu, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rht_try(SEXP nSEXP, SEXP nuSEXP, SEXP sigmaSEXP) {
+// cpp_qgpd
+NumericVector cpp_qgpd(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qgpd_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rht(n, nu, sigma));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qgpd(p, mu, sigma, xi, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rht(SEXP nSEXP, SEXP nuSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_qgpd(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rht_try(nSEXP, nuSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgpd_try(pSEXP, muSEXP, sigmaSEXP, xiSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3076,25 +3377,25 @@ RcppExport SEXP _extraDistr_cpp_rht(SEXP nSEXP, SEXP nuSEXP, SEXP sigmaSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dhuber
-NumericVector cpp_dhuber(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& log_prob);
-static SEXP _extraDistr_cpp_dhuber_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP log_probSEXP) {
+// cpp_rgpd
+NumericVector cpp_rgpd(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& sorted);
+static SEXP _extraDistr_cpp_rgpd_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dhuber(x, mu, sigma, epsilon, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgpd(n, mu, sigma, xi, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dhuber(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rgpd(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dhuber_try(xSEXP, muSEXP, sigmaSEXP, epsilonSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgpd_try(nSEXP, muSEXP, sigmaSEXP, xiSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3114,26 +3415,26 @@ RcppExport SEXP _extraDistr_cpp_dhuber(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_phuber
-NumericVector cpp_phuber(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_phuber_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rextreme_gpd
+NumericVector cpp_rextreme_gpd(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_gpd_try(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_phuber(x, mu, sigma, epsilon, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_gpd(n, size, mu, sigma, xi, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_phuber(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_gpd(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_phuber_try(xSEXP, muSEXP, sigmaSEXP, epsilonSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_gpd_try(nSEXP, sizeSEXP, muSEXP, sigmaSEXP, xiSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3153,26 +3454,26 @@ RcppExport SEXP _extraDistr_cpp_phuber(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qhuber
-NumericVector cpp_qhuber(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qhuber_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pgpd_interval
+NumericVector cpp_pgpd_interval(const NumericVector& a, const NumericVector& b, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgpd_interval_try(SEXP aSEXP, SEXP bSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qhuber(p, mu, sigma, epsilon, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pgpd_interval(a, b, mu, sigma, xi, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qhuber(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgpd_interval(SEXP aSEXP, SEXP bSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qhuber_try(pSEXP, muSEXP, sigmaSEXP, epsilonSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgpd_interval_try(aSEXP, bSEXP, muSEXP, sigmaSEXP, xiSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3192,24 +3493,26 @@ RcppExport SEXP _extraDistr_cpp_qhuber(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rhuber
-NumericVector cpp_rhuber(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon);
-static SEXP _extraDistr_cpp_rhuber_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP) {
+// cpp_hazard_gpd
+NumericVector cpp_hazard_gpd(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& xi, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_gpd_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rhuber(n, mu, sigma, epsilon));
+    Rcpp::traits::input_parameter< const NumericVector& >::type xi(xiSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_gpd(x, mu, sigma, xi, cumulative, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rhuber(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP) {
+RcppExport SEXP _extraDistr_cpp_hazard_gpd(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP xiSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rhuber_try(nSEXP, muSEXP, sigmaSEXP, epsilonSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_gpd_try(xSEXP, muSEXP, sigmaSEXP, xiSEXP, cumulativeSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3229,24 +3532,25 @@ RcppExport SEXP _extraDistr_cpp_rhuber(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dinvgamma
-NumericVector cpp_dinvgamma(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
-static SEXP _extraDistr_cpp_dinvgamma_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+// cpp_gpd_threshold
+Rcpp::List cpp_gpd_threshold(const Rcpp::List& series, const NumericVector& threshold, const int& min_exceed, const int& maxit, const double& tol);
+static SEXP _extraDistr_cpp_gpd_threshold_try(SEXP seriesSEXP, SEXP thresholdSEXP, SEXP min_exceedSEXP, SEXP maxitSEXP, SEXP tolSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dinvgamma(x, alpha, beta, log_prob));
+    Rcpp::traits::input_parameter< const Rcpp::List& >::type series(seriesSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type threshold(thresholdSEXP);
+    Rcpp::traits::input_parameter< const int& >::type min_exceed(min_exceedSEXP);
+    Rcpp::traits::input_parameter< const int& >::type maxit(maxitSEXP);
+    Rcpp::traits::input_parameter< const double& >::type tol(tolSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_gpd_threshold(series, threshold, min_exceed, maxit, tol));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_gpd_threshold(SEXP seriesSEXP, SEXP thresholdSEXP, SEXP min_exceedSEXP, SEXP maxitSEXP, SEXP tolSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dinvgamma_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_gpd_threshold_try(seriesSEXP, thresholdSEXP, min_exceedSEXP, maxitSEXP, tolSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3266,25 +3570,24 @@ RcppExport SEXP _extraDistr_cpp_dinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaS
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pinvgamma
-NumericVector cpp_pinvgamma(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pinvgamma_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dgumbel
+NumericVector cpp_dgumbel(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dgumbel_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pinvgamma(x, alpha, beta, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dgumbel(x, mu, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dgumbel(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pinvgamma_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dgumbel_try(xSEXP, muSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3304,24 +3607,25 @@ RcppExport SEXP _extraDistr_cpp_pinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaS
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dkumar
-NumericVector cpp_dkumar(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& log_prob);
-static SEXP _extraDistr_cpp_dkumar_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+// cpp_pgumbel
+NumericVector cpp_pgumbel(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgumbel_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dkumar(x, a, b, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pgumbel(x, mu, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dkumar(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgumbel(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dkumar_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgumbel_try(xSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3341,25 +3645,25 @@ RcppExport SEXP _extraDistr_cpp_dkumar(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pkumar
-NumericVector cpp_pkumar(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pkumar_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_qgumbel
+NumericVector cpp_qgumbel(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qgumbel_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pkumar(x, a, b, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qgumbel(p, mu, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pkumar(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qgumbel(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pkumar_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qgumbel_try(pSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3379,25 +3683,24 @@ RcppExport SEXP _extraDistr_cpp_pkumar(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qkumar
-NumericVector cpp_qkumar(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qkumar_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rgumbel
+NumericVector cpp_rgumbel(const int& n, const NumericVector& mu, const NumericVector& sigma, const bool& sorted);
+static SEXP _extraDistr_cpp_rgumbel_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qkumar(p, a, b, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rgumbel(n, mu, sigma, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qkumar(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rgumbel(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qkumar_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rgumbel_try(nSEXP, muSEXP, sigmaSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3417,23 +3720,25 @@ RcppExport SEXP _extraDistr_cpp_qkumar(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rkumar
-NumericVector cpp_rkumar(const int& n, const NumericVector& a, const NumericVector& b);
-static SEXP _extraDistr_cpp_rkumar_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+// cpp_rextreme_gumbel
+NumericVector cpp_rextreme_gumbel(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_gumbel_try(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rkumar(n, a, b));
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_gumbel(n, size, mu, sigma, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rkumar(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_gumbel(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rkumar_try(nSEXP, aSEXP, bSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_gumbel_try(nSEXP, sizeSEXP, muSEXP, sigmaSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3453,24 +3758,25 @@ RcppExport SEXP _extraDistr_cpp_rkumar(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dlaplace
-NumericVector cpp_dlaplace(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_dlaplace_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_pgumbel_interval
+NumericVector cpp_pgumbel_interval(const NumericVector& a, const NumericVector& b, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_pgumbel_interval_try(SEXP aSEXP, SEXP bSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dlaplace(x, mu, sigma, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pgumbel_interval(a, b, mu, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dlaplace(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pgumbel_interval(SEXP aSEXP, SEXP bSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlaplace_try(xSEXP, muSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pgumbel_interval_try(aSEXP, bSEXP, muSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3490,25 +3796,25 @@ RcppExport SEXP _extraDistr_cpp_dlaplace(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_plaplace
-NumericVector cpp_plaplace(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_plaplace_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_hazard_gumbel
+NumericVector cpp_hazard_gumbel(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_gumbel_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_plaplace(x, mu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_gumbel(x, mu, sigma, cumulative, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_plaplace(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_hazard_gumbel(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_plaplace_try(xSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_gumbel_try(xSEXP, muSEXP, sigmaSEXP, cumulativeSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3528,25 +3834,23 @@ RcppExport SEXP _extraDistr_cpp_plaplace(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qlaplace
-NumericVector cpp_qlaplace(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qlaplace_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dhcauchy
+NumericVector cpp_dhcauchy(const NumericVector& x, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dhcauchy_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qlaplace(p, mu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dhcauchy(x, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qlaplace(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dhcauchy(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlaplace_try(pSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dhcauchy_try(xSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3566,23 +3870,24 @@ RcppExport SEXP _extraDistr_cpp_qlaplace(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rlaplace
-NumericVector cpp_rlaplace(const int& n, const NumericVector& mu, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rlaplace_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+// cpp_phcauchy
+NumericVector cpp_phcauchy(const NumericVector& x, const NumericVector& sigma, bool lower_tail, bool log_prob);
+static SEXP _extraDistr_cpp_phcauchy_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rlaplace(n, mu, sigma));
+    Rcpp::traits::input_parameter< bool >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_phcauchy(x, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rlaplace(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_phcauchy(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlaplace_try(nSEXP, muSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_phcauchy_try(xSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3602,25 +3907,24 @@ RcppExport SEXP _extraDistr_cpp_rlaplace(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dlst
-NumericVector cpp_dlst(const NumericVector& x, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_dlst_try(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_qhcauchy
+NumericVector cpp_qhcauchy(const NumericVector& p, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qhcauchy_try(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dlst(x, nu, mu, sigma, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qhcauchy(p, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dlst(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qhcauchy(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlst_try(xSEXP, nuSEXP, muSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qhcauchy_try(pSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3640,26 +3944,22 @@ RcppExport SEXP _extraDistr_cpp_dlst(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_plst
-NumericVector cpp_plst(const NumericVector& x, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_plst_try(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rhcauchy
+NumericVector cpp_rhcauchy(const int& n, const NumericVector& sigma);
+static SEXP _extraDistr_cpp_rhcauchy_try(SEXP nSEXP, SEXP sigmaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_plst(x, nu, mu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_rhcauchy(n, sigma));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_plst(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rhcauchy(SEXP nSEXP, SEXP sigmaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_plst_try(xSEXP, nuSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rhcauchy_try(nSEXP, sigmaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3679,26 +3979,23 @@ RcppExport SEXP _extraDistr_cpp_plst(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qlst
-NumericVector cpp_qlst(const NumericVector& p, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qlst_try(SEXP pSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dhnorm
+NumericVector cpp_dhnorm(const NumericVector& x, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dhnorm_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qlst(p, nu, mu, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dhnorm(x, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qlst(SEXP pSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dhnorm(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlst_try(pSEXP, nuSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dhnorm_try(xSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3718,24 +4015,24 @@ RcppExport SEXP _extraDistr_cpp_qlst(SEXP pSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rlst
-NumericVector cpp_rlst(const int& n, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rlst_try(SEXP nSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+// cpp_phnorm
+NumericVector cpp_phnorm(const NumericVector& x, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_phnorm_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rlst(n, nu, mu, sigma));
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_phnorm(x, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rlst(SEXP nSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_phnorm(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlst_try(nSEXP, nuSEXP, muSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_phnorm_try(xSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3755,23 +4052,24 @@ RcppExport SEXP _extraDistr_cpp_rlst(SEXP nSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dlgser
-NumericVector cpp_dlgser(const NumericVector& x, const NumericVector& theta, const bool& log_prob);
-static SEXP _extraDistr_cpp_dlgser_try(SEXP xSEXP, SEXP thetaSEXP, SEXP log_probSEXP) {
+// cpp_qhnorm
+NumericVector cpp_qhnorm(const NumericVector& p, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qhnorm_try(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dlgser(x, theta, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qhnorm(p, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dlgser(SEXP xSEXP, SEXP thetaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qhnorm(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlgser_try(xSEXP, thetaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qhnorm_try(pSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3791,24 +4089,22 @@ RcppExport SEXP _extraDistr_cpp_dlgser(SEXP xSEXP, SEXP thetaSEXP, SEXP log_prob
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_plgser
-NumericVector cpp_plgser(const NumericVector& x, const NumericVector& theta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_plgser_try(SEXP xSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rhnorm
+NumericVector cpp_rhnorm(const int& n, const NumericVector& sigma);
+static SEXP _extraDistr_cpp_rhnorm_try(SEXP nSEXP, SEXP sigmaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_plgser(x, theta, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rhnorm(n, sigma));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_plgser(SEXP xSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rhnorm(SEXP nSEXP, SEXP sigmaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_plgser_try(xSEXP, thetaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rhnorm_try(nSEXP, sigmaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3828,24 +4124,24 @@ RcppExport SEXP _extraDistr_cpp_plgser(SEXP xSEXP, SEXP thetaSEXP, SEXP lower_ta
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qlgser
-NumericVector cpp_qlgser(const NumericVector& p, const NumericVector& theta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qlgser_try(SEXP pSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dht
+NumericVector cpp_dht(const NumericVector& x, const NumericVector& nu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dht_try(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qlgser(p, theta, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dht(x, nu, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qlgser(SEXP pSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dht(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlgser_try(pSEXP, thetaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dht_try(xSEXP, nuSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3865,22 +4161,25 @@ RcppExport SEXP _extraDistr_cpp_qlgser(SEXP pSEXP, SEXP thetaSEXP, SEXP lower_ta
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rlgser
-NumericVector cpp_rlgser(const int& n, const NumericVector& theta);
-static SEXP _extraDistr_cpp_rlgser_try(SEXP nSEXP, SEXP thetaSEXP) {
+// cpp_pht
+NumericVector cpp_pht(const NumericVector& x, const NumericVector& nu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pht_try(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rlgser(n, theta));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pht(x, nu, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rlgser(SEXP nSEXP, SEXP thetaSEXP) {
+RcppExport SEXP _extraDistr_cpp_pht(SEXP xSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlgser_try(nSEXP, thetaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pht_try(xSEXP, nuSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3900,24 +4199,1819 @@ RcppExport SEXP _extraDistr_cpp_rlgser(SEXP nSEXP, SEXP thetaSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dlomax
-NumericVector cpp_dlomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& log_prob);
-static SEXP _extraDistr_cpp_dlomax_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
-BEGIN_RCPP
-    Rcpp::RObject rcpp_result_gen;
+// cpp_qht
+NumericVector cpp_qht(const NumericVector& p, const NumericVector& nu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qht_try(SEXP pSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qht(p, nu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qht(SEXP pSEXP, SEXP nuSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qht_try(pSEXP, nuSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rht
+NumericVector cpp_rht(const int& n, const NumericVector& nu, const NumericVector& sigma);
+static SEXP _extraDistr_cpp_rht_try(SEXP nSEXP, SEXP nuSEXP, SEXP sigmaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rht(n, nu, sigma));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rht(SEXP nSEXP, SEXP nuSEXP, SEXP sigmaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rht_try(nSEXP, nuSEXP, sigmaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dhuber
+NumericVector cpp_dhuber(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& log_prob);
+static SEXP _extraDistr_cpp_dhuber_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dhuber(x, mu, sigma, epsilon, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dhuber(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dhuber_try(xSEXP, muSEXP, sigmaSEXP, epsilonSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_phuber
+NumericVector cpp_phuber(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_phuber_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_phuber(x, mu, sigma, epsilon, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_phuber(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_phuber_try(xSEXP, muSEXP, sigmaSEXP, epsilonSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qhuber
+NumericVector cpp_qhuber(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qhuber_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qhuber(p, mu, sigma, epsilon, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qhuber(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qhuber_try(pSEXP, muSEXP, sigmaSEXP, epsilonSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rhuber
+NumericVector cpp_rhuber(const int& n, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& sorted);
+static SEXP _extraDistr_cpp_rhuber_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP sortedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rhuber(n, mu, sigma, epsilon, sorted));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rhuber(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP sortedSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rhuber_try(nSEXP, muSEXP, sigmaSEXP, epsilonSEXP, sortedSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rextreme_huber
+NumericVector cpp_rextreme_huber(const int& n, const NumericVector& size, const NumericVector& mu, const NumericVector& sigma, const NumericVector& epsilon, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_huber_try(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP minimumSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_huber(n, size, mu, sigma, epsilon, minimum));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rextreme_huber(SEXP nSEXP, SEXP sizeSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP epsilonSEXP, SEXP minimumSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_huber_try(nSEXP, sizeSEXP, muSEXP, sigmaSEXP, epsilonSEXP, minimumSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_huber_rho
+NumericVector cpp_huber_rho(const NumericVector& x, const NumericVector& epsilon);
+static SEXP _extraDistr_cpp_huber_rho_try(SEXP xSEXP, SEXP epsilonSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_huber_rho(x, epsilon));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_huber_rho(SEXP xSEXP, SEXP epsilonSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_huber_rho_try(xSEXP, epsilonSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_huber_psi
+NumericVector cpp_huber_psi(const NumericVector& x, const NumericVector& epsilon);
+static SEXP _extraDistr_cpp_huber_psi_try(SEXP xSEXP, SEXP epsilonSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_huber_psi(x, epsilon));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_huber_psi(SEXP xSEXP, SEXP epsilonSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_huber_psi_try(xSEXP, epsilonSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_huber_weight
+NumericVector cpp_huber_weight(const NumericVector& x, const NumericVector& epsilon);
+static SEXP _extraDistr_cpp_huber_weight_try(SEXP xSEXP, SEXP epsilonSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type epsilon(epsilonSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_huber_weight(x, epsilon));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_huber_weight(SEXP xSEXP, SEXP epsilonSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_huber_weight_try(xSEXP, epsilonSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_huber_scale
+double cpp_huber_scale(const NumericVector& x, const double& epsilon, const bool& proposal2, const int& maxit, const double& tol);
+static SEXP _extraDistr_cpp_huber_scale_try(SEXP xSEXP, SEXP epsilonSEXP, SEXP proposal2SEXP, SEXP maxitSEXP, SEXP tolSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const double& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type proposal2(proposal2SEXP);
+    Rcpp::traits::input_parameter< const int& >::type maxit(maxitSEXP);
+    Rcpp::traits::input_parameter< const double& >::type tol(tolSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_huber_scale(x, epsilon, proposal2, maxit, tol));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_huber_scale(SEXP xSEXP, SEXP epsilonSEXP, SEXP proposal2SEXP, SEXP maxitSEXP, SEXP tolSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_huber_scale_try(xSEXP, epsilonSEXP, proposal2SEXP, maxitSEXP, tolSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_huber_irls
+Rcpp::List cpp_huber_irls(const NumericMatrix& X, const NumericVector& y, const double& epsilon, const bool& proposal2, const int& maxit, const double& tol);
+static SEXP _extraDistr_cpp_huber_irls_try(SEXP XSEXP, SEXP ySEXP, SEXP epsilonSEXP, SEXP proposal2SEXP, SEXP maxitSEXP, SEXP tolSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type X(XSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type y(ySEXP);
+    Rcpp::traits::input_parameter< const double& >::type epsilon(epsilonSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type proposal2(proposal2SEXP);
+    Rcpp::traits::input_parameter< const int& >::type maxit(maxitSEXP);
+    Rcpp::traits::input_parameter< const double& >::type tol(tolSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_huber_irls(X, y, epsilon, proposal2, maxit, tol));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_huber_irls(SEXP XSEXP, SEXP ySEXP, SEXP epsilonSEXP, SEXP proposal2SEXP, SEXP maxitSEXP, SEXP tolSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_huber_irls_try(XSEXP, ySEXP, epsilonSEXP, proposal2SEXP, maxitSEXP, tolSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dinvgamma
+NumericVector cpp_dinvgamma(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
+static SEXP _extraDistr_cpp_dinvgamma_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dinvgamma(x, alpha, beta, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dinvgamma_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_pinvgamma
+NumericVector cpp_pinvgamma(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pinvgamma_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pinvgamma(x, alpha, beta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pinvgamma(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pinvgamma_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dkumar
+NumericVector cpp_dkumar(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& log_prob);
+static SEXP _extraDistr_cpp_dkumar_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dkumar(x, a, b, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dkumar(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dkumar_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_pkumar
+NumericVector cpp_pkumar(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pkumar_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pkumar(x, a, b, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pkumar(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pkumar_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qkumar
+NumericVector cpp_qkumar(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qkumar_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qkumar(p, a, b, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qkumar(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qkumar_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rkumar
+NumericVector cpp_rkumar(const int& n, const NumericVector& a, const NumericVector& b, const bool& sorted);
+static SEXP _extraDistr_cpp_rkumar_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP, SEXP sortedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rkumar(n, a, b, sorted));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rkumar(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP, SEXP sortedSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rkumar_try(nSEXP, aSEXP, bSEXP, sortedSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rextreme_kumar
+NumericVector cpp_rextreme_kumar(const int& n, const NumericVector& size, const NumericVector& a, const NumericVector& b, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_kumar_try(SEXP nSEXP, SEXP sizeSEXP, SEXP aSEXP, SEXP bSEXP, SEXP minimumSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_kumar(n, size, a, b, minimum));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rextreme_kumar(SEXP nSEXP, SEXP sizeSEXP, SEXP aSEXP, SEXP bSEXP, SEXP minimumSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_kumar_try(nSEXP, sizeSEXP, aSEXP, bSEXP, minimumSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dlaplace
+NumericVector cpp_dlaplace(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dlaplace_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dlaplace(x, mu, sigma, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dlaplace(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlaplace_try(xSEXP, muSEXP, sigmaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_plaplace
+NumericVector cpp_plaplace(const NumericVector& x, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_plaplace_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_plaplace(x, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_plaplace(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_plaplace_try(xSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qlaplace
+NumericVector cpp_qlaplace(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qlaplace_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qlaplace(p, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qlaplace(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlaplace_try(pSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rlaplace
+NumericVector cpp_rlaplace(const int& n, const NumericVector& mu, const NumericVector& sigma);
+static SEXP _extraDistr_cpp_rlaplace_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rlaplace(n, mu, sigma));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rlaplace(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlaplace_try(nSEXP, muSEXP, sigmaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dlst
+NumericVector cpp_dlst(const NumericVector& x, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dlst_try(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dlst(x, nu, mu, sigma, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dlst(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlst_try(xSEXP, nuSEXP, muSEXP, sigmaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_plst
+NumericVector cpp_plst(const NumericVector& x, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_plst_try(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_plst(x, nu, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_plst(SEXP xSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_plst_try(xSEXP, nuSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qlst
+NumericVector cpp_qlst(const NumericVector& p, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qlst_try(SEXP pSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qlst(p, nu, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qlst(SEXP pSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlst_try(pSEXP, nuSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rlst
+NumericVector cpp_rlst(const int& n, const NumericVector& nu, const NumericVector& mu, const NumericVector& sigma);
+static SEXP _extraDistr_cpp_rlst_try(SEXP nSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type nu(nuSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rlst(n, nu, mu, sigma));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rlst(SEXP nSEXP, SEXP nuSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlst_try(nSEXP, nuSEXP, muSEXP, sigmaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dlgser
+NumericVector cpp_dlgser(const NumericVector& x, const NumericVector& theta, const bool& log_prob);
+static SEXP _extraDistr_cpp_dlgser_try(SEXP xSEXP, SEXP thetaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dlgser(x, theta, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dlgser(SEXP xSEXP, SEXP thetaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlgser_try(xSEXP, thetaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_plgser
+NumericVector cpp_plgser(const NumericVector& x, const NumericVector& theta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_plgser_try(SEXP xSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_plgser(x, theta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_plgser(SEXP xSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_plgser_try(xSEXP, thetaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qlgser
+NumericVector cpp_qlgser(const NumericVector& p, const NumericVector& theta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qlgser_try(SEXP pSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qlgser(p, theta, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qlgser(SEXP pSEXP, SEXP thetaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlgser_try(pSEXP, thetaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rlgser
+NumericVector cpp_rlgser(const int& n, const NumericVector& theta);
+static SEXP _extraDistr_cpp_rlgser_try(SEXP nSEXP, SEXP thetaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type theta(thetaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rlgser(n, theta));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rlgser(SEXP nSEXP, SEXP thetaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlgser_try(nSEXP, thetaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dlomax
+NumericVector cpp_dlomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& log_prob);
+static SEXP _extraDistr_cpp_dlomax_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dlomax(x, lambda, kappa, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dlomax(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlomax_try(xSEXP, lambdaSEXP, kappaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_plomax
+NumericVector cpp_plomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_plomax_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_plomax(x, lambda, kappa, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_plomax(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_plomax_try(xSEXP, lambdaSEXP, kappaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_qlomax
+NumericVector cpp_qlomax(const NumericVector& p, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qlomax_try(SEXP pSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qlomax(p, lambda, kappa, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qlomax(SEXP pSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlomax_try(pSEXP, lambdaSEXP, kappaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rlomax
+NumericVector cpp_rlomax(const int& n, const NumericVector& lambda, const NumericVector& kappa, const bool& sorted);
+static SEXP _extraDistr_cpp_rlomax_try(SEXP nSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP sortedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rlomax(n, lambda, kappa, sorted));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rlomax(SEXP nSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP sortedSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlomax_try(nSEXP, lambdaSEXP, kappaSEXP, sortedSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rextreme_lomax
+NumericVector cpp_rextreme_lomax(const int& n, const NumericVector& size, const NumericVector& lambda, const NumericVector& kappa, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_lomax_try(SEXP nSEXP, SEXP sizeSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP minimumSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_lomax(n, size, lambda, kappa, minimum));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rextreme_lomax(SEXP nSEXP, SEXP sizeSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP minimumSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_lomax_try(nSEXP, sizeSEXP, lambdaSEXP, kappaSEXP, minimumSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_plomax_interval
+NumericVector cpp_plomax_interval(const NumericVector& a, const NumericVector& b, const NumericVector& lambda, const NumericVector& kappa, const bool& log_prob);
+static SEXP _extraDistr_cpp_plomax_interval_try(SEXP aSEXP, SEXP bSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_plomax_interval(a, b, lambda, kappa, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_plomax_interval(SEXP aSEXP, SEXP bSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_plomax_interval_try(aSEXP, bSEXP, lambdaSEXP, kappaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dcens_lomax
+NumericVector cpp_dcens_lomax(const NumericVector& x, const NumericVector& status, const NumericVector& lambda, const NumericVector& kappa, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_lomax_try(SEXP xSEXP, SEXP statusSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_lomax(x, status, lambda, kappa, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dcens_lomax(SEXP xSEXP, SEXP statusSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_lomax_try(xSEXP, statusSEXP, lambdaSEXP, kappaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_hazard_lomax
+NumericVector cpp_hazard_lomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_lomax_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_lomax(x, lambda, kappa, cumulative, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_hazard_lomax(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_lomax_try(xSEXP, lambdaSEXP, kappaSEXP, cumulativeSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dmixnorm
+NumericVector cpp_dmixnorm(const NumericVector& x, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha, const bool& log_prob);
+static SEXP _extraDistr_cpp_dmixnorm_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmixnorm(x, mu, sigma, alpha, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmixnorm_try(xSEXP, muSEXP, sigmaSEXP, alphaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_pmixnorm
+NumericVector cpp_pmixnorm(const NumericVector& x, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pmixnorm_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pmixnorm(x, mu, sigma, alpha, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pmixnorm_try(xSEXP, muSEXP, sigmaSEXP, alphaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rmixnorm
+NumericVector cpp_rmixnorm(const int& n, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha);
+static SEXP _extraDistr_cpp_rmixnorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmixnorm(n, mu, sigma, alpha));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rmixnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmixnorm_try(nSEXP, muSEXP, sigmaSEXP, alphaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dmixpois
+NumericVector cpp_dmixpois(const NumericVector& x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& log_prob);
+static SEXP _extraDistr_cpp_dmixpois_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dlomax(x, lambda, kappa, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dmixpois(x, lambda, alpha, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmixpois_try(xSEXP, lambdaSEXP, alphaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_pmixpois
+NumericVector cpp_pmixpois(const NumericVector& x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pmixpois_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_pmixpois(x, lambda, alpha, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_pmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pmixpois_try(xSEXP, lambdaSEXP, alphaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rmixpois
+NumericVector cpp_rmixpois(const int& n, const NumericMatrix& lambda, const NumericMatrix& alpha);
+static SEXP _extraDistr_cpp_rmixpois_try(SEXP nSEXP, SEXP lambdaSEXP, SEXP alphaSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmixpois(n, lambda, alpha));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rmixpois(SEXP nSEXP, SEXP lambdaSEXP, SEXP alphaSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmixpois_try(nSEXP, lambdaSEXP, alphaSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dmnom
+NumericVector cpp_dmnom(const NumericMatrix& x, const NumericVector& size, const NumericMatrix& prob, const bool& log_prob);
+static SEXP _extraDistr_cpp_dmnom_try(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type prob(probSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmnom(x, size, prob, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dmnom(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmnom_try(xSEXP, sizeSEXP, probSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rmnom
+NumericMatrix cpp_rmnom(const int& n, const NumericVector& size, const NumericMatrix& prob);
+static SEXP _extraDistr_cpp_rmnom_try(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type prob(probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmnom(n, size, prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rmnom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmnom_try(nSEXP, sizeSEXP, probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_dmvhyper
+NumericVector cpp_dmvhyper(const NumericMatrix& x, const NumericMatrix& n, const NumericVector& k, const bool& log_prob);
+static SEXP _extraDistr_cpp_dmvhyper_try(SEXP xSEXP, SEXP nSEXP, SEXP kSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type k(kSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dmvhyper(x, n, k, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dmvhyper(SEXP xSEXP, SEXP nSEXP, SEXP kSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmvhyper_try(xSEXP, nSEXP, kSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rmvhyper
+NumericMatrix cpp_rmvhyper(const int& nn, const NumericMatrix& n, const NumericVector& k);
+static SEXP _extraDistr_cpp_rmvhyper_try(SEXP nnSEXP, SEXP nSEXP, SEXP kSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type nn(nnSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type k(kSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmvhyper(nn, n, k));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dlomax(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rmvhyper(SEXP nnSEXP, SEXP nSEXP, SEXP kSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dlomax_try(xSEXP, lambdaSEXP, kappaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmvhyper_try(nnSEXP, nSEXP, kSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3937,25 +6031,24 @@ RcppExport SEXP _extraDistr_cpp_dlomax(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_plomax
-NumericVector cpp_plomax(const NumericVector& x, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_plomax_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dmvnorm
+NumericVector cpp_dmvnorm(const NumericMatrix& x, const NumericMatrix& mu, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dmvnorm_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_plomax(x, lambda, kappa, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dmvnorm(x, mu, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_plomax(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dmvnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_plomax_try(xSEXP, lambdaSEXP, kappaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmvnorm_try(xSEXP, muSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -3975,25 +6068,23 @@ RcppExport SEXP _extraDistr_cpp_plomax(SEXP xSEXP, SEXP lambdaSEXP, SEXP kappaSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qlomax
-NumericVector cpp_qlomax(const NumericVector& p, const NumericVector& lambda, const NumericVector& kappa, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qlomax_try(SEXP pSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rmvnorm
+NumericMatrix cpp_rmvnorm(const int& n, const NumericMatrix& mu, const NumericVector& sigma);
+static SEXP _extraDistr_cpp_rmvnorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qlomax(p, lambda, kappa, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rmvnorm(n, mu, sigma));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qlomax(SEXP pSEXP, SEXP lambdaSEXP, SEXP kappaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rmvnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qlomax_try(pSEXP, lambdaSEXP, kappaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmvnorm_try(nSEXP, muSEXP, sigmaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4013,23 +6104,25 @@ RcppExport SEXP _extraDistr_cpp_qlomax(SEXP pSEXP, SEXP lambdaSEXP, SEXP kappaSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rlomax
-NumericVector cpp_rlomax(const int& n, const NumericVector& lambda, const NumericVector& kappa);
-static SEXP _extraDistr_cpp_rlomax_try(SEXP nSEXP, SEXP lambdaSEXP, SEXP kappaSEXP) {
+// cpp_dnhyper
+NumericVector cpp_dnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& log_prob);
+static SEXP _extraDistr_cpp_dnhyper_try(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type kappa(kappaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rlomax(n, lambda, kappa));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dnhyper(x, n, m, r, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rlomax(SEXP nSEXP, SEXP lambdaSEXP, SEXP kappaSEXP) {
+RcppExport SEXP _extraDistr_cpp_dnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rlomax_try(nSEXP, lambdaSEXP, kappaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dnhyper_try(xSEXP, nSEXP, mSEXP, rSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4049,25 +6142,26 @@ RcppExport SEXP _extraDistr_cpp_rlomax(SEXP nSEXP, SEXP lambdaSEXP, SEXP kappaSE
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dmixnorm
-NumericVector cpp_dmixnorm(const NumericVector& x, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha, const bool& log_prob);
-static SEXP _extraDistr_cpp_dmixnorm_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+// cpp_pnhyper
+NumericVector cpp_pnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pnhyper_try(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dmixnorm(x, mu, sigma, alpha, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pnhyper(x, n, m, r, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmixnorm_try(xSEXP, muSEXP, sigmaSEXP, alphaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pnhyper_try(xSEXP, nSEXP, mSEXP, rSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4087,26 +6181,26 @@ RcppExport SEXP _extraDistr_cpp_dmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pmixnorm
-NumericVector cpp_pmixnorm(const NumericVector& x, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pmixnorm_try(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_qnhyper
+NumericVector cpp_qnhyper(const NumericVector& p, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qnhyper_try(SEXP pSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pmixnorm(x, mu, sigma, alpha, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qnhyper(p, n, m, r, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qnhyper(SEXP pSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pmixnorm_try(xSEXP, muSEXP, sigmaSEXP, alphaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qnhyper_try(pSEXP, nSEXP, mSEXP, rSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4126,24 +6220,24 @@ RcppExport SEXP _extraDistr_cpp_pmixnorm(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rmixnorm
-NumericVector cpp_rmixnorm(const int& n, const NumericMatrix& mu, const NumericMatrix& sigma, const NumericMatrix& alpha);
-static SEXP _extraDistr_cpp_rmixnorm_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP) {
+// cpp_rnhyper
+NumericVector cpp_rnhyper(const int& nn, const NumericVector& n, const NumericVector& m, const NumericVector& r);
+static SEXP _extraDistr_cpp_rnhyper_try(SEXP nnSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type mu(muSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rmixnorm(n, mu, sigma, alpha));
+    Rcpp::traits::input_parameter< const int& >::type nn(nnSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rnhyper(nn, n, m, r));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rmixnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP alphaSEXP) {
+RcppExport SEXP _extraDistr_cpp_rnhyper(SEXP nnSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmixnorm_try(nSEXP, muSEXP, sigmaSEXP, alphaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rnhyper_try(nnSEXP, nSEXP, mSEXP, rSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4163,24 +6257,26 @@ RcppExport SEXP _extraDistr_cpp_rmixnorm(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dmixpois
-NumericVector cpp_dmixpois(const NumericVector& x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& log_prob);
-static SEXP _extraDistr_cpp_dmixpois_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+// cpp_dnsbeta
+NumericVector cpp_dnsbeta(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
+static SEXP _extraDistr_cpp_dnsbeta_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dmixpois(x, lambda, alpha, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dnsbeta(x, alpha, beta, lower, upper, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmixpois_try(xSEXP, lambdaSEXP, alphaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dnsbeta_try(xSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4200,25 +6296,27 @@ RcppExport SEXP _extraDistr_cpp_dmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alpha
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pmixpois
-NumericVector cpp_pmixpois(const NumericVector& x, const NumericMatrix& lambda, const NumericMatrix& alpha, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pmixpois_try(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pnsbeta
+NumericVector cpp_pnsbeta(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pnsbeta_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pmixpois(x, lambda, alpha, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pnsbeta(x, alpha, beta, lower, upper, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alphaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pmixpois_try(xSEXP, lambdaSEXP, alphaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pnsbeta_try(xSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4238,23 +6336,27 @@ RcppExport SEXP _extraDistr_cpp_pmixpois(SEXP xSEXP, SEXP lambdaSEXP, SEXP alpha
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rmixpois
-NumericVector cpp_rmixpois(const int& n, const NumericMatrix& lambda, const NumericMatrix& alpha);
-static SEXP _extraDistr_cpp_rmixpois_try(SEXP nSEXP, SEXP lambdaSEXP, SEXP alphaSEXP) {
+// cpp_qnsbeta
+NumericVector cpp_qnsbeta(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qnsbeta_try(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type lambda(lambdaSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type alpha(alphaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rmixpois(n, lambda, alpha));
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qnsbeta(p, alpha, beta, lower, upper, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rmixpois(SEXP nSEXP, SEXP lambdaSEXP, SEXP alphaSEXP) {
+RcppExport SEXP _extraDistr_cpp_qnsbeta(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmixpois_try(nSEXP, lambdaSEXP, alphaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qnsbeta_try(pSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4274,24 +6376,25 @@ RcppExport SEXP _extraDistr_cpp_rmixpois(SEXP nSEXP, SEXP lambdaSEXP, SEXP alpha
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dmnom
-NumericVector cpp_dmnom(const NumericMatrix& x, const NumericVector& size, const NumericMatrix& prob, const bool& log_prob);
-static SEXP _extraDistr_cpp_dmnom_try(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP log_probSEXP) {
+// cpp_rnsbeta
+NumericVector cpp_rnsbeta(const int& n, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper);
+static SEXP _extraDistr_cpp_rnsbeta_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type prob(probSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dmnom(x, size, prob, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rnsbeta(n, alpha, beta, lower, upper));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dmnom(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rnsbeta(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmnom_try(xSEXP, sizeSEXP, probSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rnsbeta_try(nSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4311,23 +6414,24 @@ RcppExport SEXP _extraDistr_cpp_dmnom(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rmnom
-NumericMatrix cpp_rmnom(const int& n, const NumericVector& size, const NumericMatrix& prob);
-static SEXP _extraDistr_cpp_rmnom_try(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+// cpp_dpareto
+NumericVector cpp_dpareto(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& log_prob);
+static SEXP _extraDistr_cpp_dpareto_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type prob(probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rmnom(n, size, prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dpareto(x, a, b, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rmnom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dpareto(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmnom_try(nSEXP, sizeSEXP, probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dpareto_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4347,24 +6451,25 @@ RcppExport SEXP _extraDistr_cpp_rmnom(SEXP nSEXP, SEXP sizeSEXP, SEXP probSEXP)
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dmvhyper
-NumericVector cpp_dmvhyper(const NumericMatrix& x, const NumericMatrix& n, const NumericVector& k, const bool& log_prob);
-static SEXP _extraDistr_cpp_dmvhyper_try(SEXP xSEXP, SEXP nSEXP, SEXP kSEXP, SEXP log_probSEXP) {
+// cpp_ppareto
+NumericVector cpp_ppareto(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_ppareto_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type k(kSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dmvhyper(x, n, k, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_ppareto(x, a, b, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dmvhyper(SEXP xSEXP, SEXP nSEXP, SEXP kSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_ppareto(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dmvhyper_try(xSEXP, nSEXP, kSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_ppareto_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4384,23 +6489,25 @@ RcppExport SEXP _extraDistr_cpp_dmvhyper(SEXP xSEXP, SEXP nSEXP, SEXP kSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rmvhyper
-NumericMatrix cpp_rmvhyper(const int& nn, const NumericMatrix& n, const NumericVector& k);
-static SEXP _extraDistr_cpp_rmvhyper_try(SEXP nnSEXP, SEXP nSEXP, SEXP kSEXP) {
+// cpp_qpareto
+NumericVector cpp_qpareto(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qpareto_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type nn(nnSEXP);
-    Rcpp::traits::input_parameter< const NumericMatrix& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type k(kSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rmvhyper(nn, n, k));
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qpareto(p, a, b, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rmvhyper(SEXP nnSEXP, SEXP nSEXP, SEXP kSEXP) {
+RcppExport SEXP _extraDistr_cpp_qpareto(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rmvhyper_try(nnSEXP, nSEXP, kSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qpareto_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4420,25 +6527,24 @@ RcppExport SEXP _extraDistr_cpp_rmvhyper(SEXP nnSEXP, SEXP nSEXP, SEXP kSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dnhyper
-NumericVector cpp_dnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& log_prob);
-static SEXP _extraDistr_cpp_dnhyper_try(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP log_probSEXP) {
+// cpp_rpareto
+NumericVector cpp_rpareto(const int& n, const NumericVector& a, const NumericVector& b, const bool& sorted);
+static SEXP _extraDistr_cpp_rpareto_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dnhyper(x, n, m, r, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rpareto(n, a, b, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rpareto(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dnhyper_try(xSEXP, nSEXP, mSEXP, rSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rpareto_try(nSEXP, aSEXP, bSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4458,26 +6564,25 @@ RcppExport SEXP _extraDistr_cpp_dnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pnhyper
-NumericVector cpp_pnhyper(const NumericVector& x, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pnhyper_try(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_rextreme_pareto
+NumericVector cpp_rextreme_pareto(const int& n, const NumericVector& size, const NumericVector& a, const NumericVector& b, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_pareto_try(SEXP nSEXP, SEXP sizeSEXP, SEXP aSEXP, SEXP bSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pnhyper(x, n, m, r, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_pareto(n, size, a, b, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_pareto(SEXP nSEXP, SEXP sizeSEXP, SEXP aSEXP, SEXP bSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pnhyper_try(xSEXP, nSEXP, mSEXP, rSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_pareto_try(nSEXP, sizeSEXP, aSEXP, bSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4497,26 +6602,25 @@ RcppExport SEXP _extraDistr_cpp_pnhyper(SEXP xSEXP, SEXP nSEXP, SEXP mSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qnhyper
-NumericVector cpp_qnhyper(const NumericVector& p, const NumericVector& n, const NumericVector& m, const NumericVector& r, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qnhyper_try(SEXP pSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dcens_pareto
+NumericVector cpp_dcens_pareto(const NumericVector& x, const NumericVector& status, const NumericVector& a, const NumericVector& b, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_pareto_try(SEXP xSEXP, SEXP statusSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qnhyper(p, n, m, r, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_pareto(x, status, a, b, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qnhyper(SEXP pSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dcens_pareto(SEXP xSEXP, SEXP statusSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qnhyper_try(pSEXP, nSEXP, mSEXP, rSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_pareto_try(xSEXP, statusSEXP, aSEXP, bSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4536,24 +6640,25 @@ RcppExport SEXP _extraDistr_cpp_qnhyper(SEXP pSEXP, SEXP nSEXP, SEXP mSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rnhyper
-NumericVector cpp_rnhyper(const int& nn, const NumericVector& n, const NumericVector& m, const NumericVector& r);
-static SEXP _extraDistr_cpp_rnhyper_try(SEXP nnSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP) {
+// cpp_hazard_pareto
+NumericVector cpp_hazard_pareto(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_pareto_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type nn(nnSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type m(mSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type r(rSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rnhyper(nn, n, m, r));
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_pareto(x, a, b, cumulative, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rnhyper(SEXP nnSEXP, SEXP nSEXP, SEXP mSEXP, SEXP rSEXP) {
+RcppExport SEXP _extraDistr_cpp_hazard_pareto(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rnhyper_try(nnSEXP, nSEXP, mSEXP, rSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_pareto_try(xSEXP, aSEXP, bSEXP, cumulativeSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4573,26 +6678,24 @@ RcppExport SEXP _extraDistr_cpp_rnhyper(SEXP nnSEXP, SEXP nSEXP, SEXP mSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dnsbeta
-NumericVector cpp_dnsbeta(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& log_prob);
-static SEXP _extraDistr_cpp_dnsbeta_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
+// cpp_dpower
+NumericVector cpp_dpower(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
+static SEXP _extraDistr_cpp_dpower_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dnsbeta(x, alpha, beta, lower, upper, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dpower(x, alpha, beta, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dpower(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dnsbeta_try(xSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dpower_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4612,27 +6715,25 @@ RcppExport SEXP _extraDistr_cpp_dnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pnsbeta
-NumericVector cpp_pnsbeta(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pnsbeta_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_ppower
+NumericVector cpp_ppower(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_ppower_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pnsbeta(x, alpha, beta, lower, upper, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_ppower(x, alpha, beta, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_ppower(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pnsbeta_try(xSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_ppower_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4652,27 +6753,25 @@ RcppExport SEXP _extraDistr_cpp_pnsbeta(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qnsbeta
-NumericVector cpp_qnsbeta(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qnsbeta_try(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_qpower
+NumericVector cpp_qpower(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qpower_try(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qnsbeta(p, alpha, beta, lower, upper, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qpower(p, alpha, beta, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qnsbeta(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qpower(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qnsbeta_try(pSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qpower_try(pSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4692,25 +6791,24 @@ RcppExport SEXP _extraDistr_cpp_qnsbeta(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rnsbeta
-NumericVector cpp_rnsbeta(const int& n, const NumericVector& alpha, const NumericVector& beta, const NumericVector& lower, const NumericVector& upper);
-static SEXP _extraDistr_cpp_rnsbeta_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+// cpp_rpower
+NumericVector cpp_rpower(const int& n, const NumericVector& alpha, const NumericVector& beta, const bool& sorted);
+static SEXP _extraDistr_cpp_rpower_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type lower(lowerSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type upper(upperSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rnsbeta(n, alpha, beta, lower, upper));
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rpower(n, alpha, beta, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rnsbeta(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lowerSEXP, SEXP upperSEXP) {
+RcppExport SEXP _extraDistr_cpp_rpower(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rnsbeta_try(nSEXP, alphaSEXP, betaSEXP, lowerSEXP, upperSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rpower_try(nSEXP, alphaSEXP, betaSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4730,24 +6828,25 @@ RcppExport SEXP _extraDistr_cpp_rnsbeta(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dpareto
-NumericVector cpp_dpareto(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& log_prob);
-static SEXP _extraDistr_cpp_dpareto_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+// cpp_rextreme_power
+NumericVector cpp_rextreme_power(const int& n, const NumericVector& size, const NumericVector& alpha, const NumericVector& beta, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_power_try(SEXP nSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dpareto(x, a, b, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_power(n, size, alpha, beta, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dpareto(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_power(SEXP nSEXP, SEXP sizeSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dpareto_try(xSEXP, aSEXP, bSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_power_try(nSEXP, sizeSEXP, alphaSEXP, betaSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4767,25 +6866,25 @@ RcppExport SEXP _extraDistr_cpp_dpareto(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_ppareto
-NumericVector cpp_ppareto(const NumericVector& x, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_ppareto_try(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dprop
+NumericVector cpp_dprop(const NumericVector& x, const NumericVector& size, const NumericVector& mean, const NumericVector& prior, const bool& log_prob);
+static SEXP _extraDistr_cpp_dprop_try(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_ppareto(x, a, b, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dprop(x, size, mean, prior, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_ppareto(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dprop(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_ppareto_try(xSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dprop_try(xSEXP, sizeSEXP, meanSEXP, priorSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4805,25 +6904,26 @@ RcppExport SEXP _extraDistr_cpp_ppareto(SEXP xSEXP, SEXP aSEXP, SEXP bSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qpareto
-NumericVector cpp_qpareto(const NumericVector& p, const NumericVector& a, const NumericVector& b, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qpareto_try(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_pprop
+NumericVector cpp_pprop(const NumericVector& x, const NumericVector& size, const NumericVector& mean, const NumericVector& prior, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_pprop_try(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qpareto(p, a, b, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_pprop(x, size, mean, prior, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qpareto(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_pprop(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qpareto_try(pSEXP, aSEXP, bSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_pprop_try(xSEXP, sizeSEXP, meanSEXP, priorSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4843,23 +6943,26 @@ RcppExport SEXP _extraDistr_cpp_qpareto(SEXP pSEXP, SEXP aSEXP, SEXP bSEXP, SEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rpareto
-NumericVector cpp_rpareto(const int& n, const NumericVector& a, const NumericVector& b);
-static SEXP _extraDistr_cpp_rpareto_try(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+// cpp_qprop
+NumericVector cpp_qprop(const NumericVector& p, const NumericVector& size, const NumericVector& mean, const NumericVector& prior, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qprop_try(SEXP pSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type a(aSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rpareto(n, a, b));
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qprop(p, size, mean, prior, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rpareto(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
+RcppExport SEXP _extraDistr_cpp_qprop(SEXP pSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rpareto_try(nSEXP, aSEXP, bSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qprop_try(pSEXP, sizeSEXP, meanSEXP, priorSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4879,24 +6982,24 @@ RcppExport SEXP _extraDistr_cpp_rpareto(SEXP nSEXP, SEXP aSEXP, SEXP bSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dpower
-NumericVector cpp_dpower(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& log_prob);
-static SEXP _extraDistr_cpp_dpower_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+// cpp_rprop
+NumericVector cpp_rprop(const int& n, const NumericVector& size, const NumericVector& mean, const NumericVector& prior);
+static SEXP _extraDistr_cpp_rprop_try(SEXP nSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dpower(x, alpha, beta, log_prob));
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rprop(n, size, mean, prior));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dpower(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rprop(SEXP nSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dpower_try(xSEXP, alphaSEXP, betaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rprop_try(nSEXP, sizeSEXP, meanSEXP, priorSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4916,25 +7019,26 @@ RcppExport SEXP _extraDistr_cpp_dpower(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_ppower
-NumericVector cpp_ppower(const NumericVector& x, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_ppower_try(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_qapprox_cheb
+NumericVector cpp_qapprox_cheb(const NumericVector& p, const NumericVector& breaks, const NumericMatrix& coefs, const IntegerVector& guide, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qapprox_cheb_try(SEXP pSEXP, SEXP breaksSEXP, SEXP coefsSEXP, SEXP guideSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type breaks(breaksSEXP);
+    Rcpp::traits::input_parameter< const NumericMatrix& >::type coefs(coefsSEXP);
+    Rcpp::traits::input_parameter< const IntegerVector& >::type guide(guideSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_ppower(x, alpha, beta, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qapprox_cheb(p, breaks, coefs, guide, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_ppower(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qapprox_cheb(SEXP pSEXP, SEXP breaksSEXP, SEXP coefsSEXP, SEXP guideSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_ppower_try(xSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qapprox_cheb_try(pSEXP, breaksSEXP, coefsSEXP, guideSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4954,25 +7058,28 @@ RcppExport SEXP _extraDistr_cpp_ppower(SEXP xSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qpower
-NumericVector cpp_qpower(const NumericVector& p, const NumericVector& alpha, const NumericVector& beta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qpower_try(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_qapprox_disc
+NumericVector cpp_qapprox_disc(const NumericVector& p, const NumericVector& cdf, const double& x0, const double& lo, const double& hi, const IntegerVector& guide, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qapprox_disc_try(SEXP pSEXP, SEXP cdfSEXP, SEXP x0SEXP, SEXP loSEXP, SEXP hiSEXP, SEXP guideSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type cdf(cdfSEXP);
+    Rcpp::traits::input_parameter< const double& >::type x0(x0SEXP);
+    Rcpp::traits::input_parameter< const double& >::type lo(loSEXP);
+    Rcpp::traits::input_parameter< const double& >::type hi(hiSEXP);
+    Rcpp::traits::input_parameter< const IntegerVector& >::type guide(guideSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qpower(p, alpha, beta, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qapprox_disc(p, cdf, x0, lo, hi, guide, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qpower(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qapprox_disc(SEXP pSEXP, SEXP cdfSEXP, SEXP x0SEXP, SEXP loSEXP, SEXP hiSEXP, SEXP guideSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qpower_try(pSEXP, alphaSEXP, betaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qapprox_disc_try(pSEXP, cdfSEXP, x0SEXP, loSEXP, hiSEXP, guideSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -4992,23 +7099,21 @@ RcppExport SEXP _extraDistr_cpp_qpower(SEXP pSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rpower
-NumericVector cpp_rpower(const int& n, const NumericVector& alpha, const NumericVector& beta);
-static SEXP _extraDistr_cpp_rpower_try(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+// cpp_rsign
+NumericVector cpp_rsign(const int& n);
+static SEXP _extraDistr_cpp_rsign_try(SEXP nSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type alpha(alphaSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type beta(betaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rpower(n, alpha, beta));
+    rcpp_result_gen = Rcpp::wrap(cpp_rsign(n));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rpower(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP) {
+RcppExport SEXP _extraDistr_cpp_rsign(SEXP nSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rpower_try(nSEXP, alphaSEXP, betaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rsign_try(nSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5028,25 +7133,23 @@ RcppExport SEXP _extraDistr_cpp_rpower(SEXP nSEXP, SEXP alphaSEXP, SEXP betaSEXP
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dprop
-NumericVector cpp_dprop(const NumericVector& x, const NumericVector& size, const NumericVector& mean, const NumericVector& prior, const bool& log_prob);
-static SEXP _extraDistr_cpp_dprop_try(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP log_probSEXP) {
+// cpp_drayleigh
+NumericVector cpp_drayleigh(const NumericVector& x, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_drayleigh_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dprop(x, size, mean, prior, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_drayleigh(x, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dprop(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_drayleigh(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dprop_try(xSEXP, sizeSEXP, meanSEXP, priorSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_drayleigh_try(xSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5066,26 +7169,24 @@ RcppExport SEXP _extraDistr_cpp_dprop(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_pprop
-NumericVector cpp_pprop(const NumericVector& x, const NumericVector& size, const NumericVector& mean, const NumericVector& prior, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_pprop_try(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_prayleigh
+NumericVector cpp_prayleigh(const NumericVector& x, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_prayleigh_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_pprop(x, size, mean, prior, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_prayleigh(x, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_pprop(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_prayleigh(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_pprop_try(xSEXP, sizeSEXP, meanSEXP, priorSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_prayleigh_try(xSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5105,26 +7206,24 @@ RcppExport SEXP _extraDistr_cpp_pprop(SEXP xSEXP, SEXP sizeSEXP, SEXP meanSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qprop
-NumericVector cpp_qprop(const NumericVector& p, const NumericVector& size, const NumericVector& mean, const NumericVector& prior, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qprop_try(SEXP pSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_qrayleigh
+NumericVector cpp_qrayleigh(const NumericVector& p, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qrayleigh_try(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qprop(p, size, mean, prior, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_qrayleigh(p, sigma, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qprop(SEXP pSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_qrayleigh(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qprop_try(pSEXP, sizeSEXP, meanSEXP, priorSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qrayleigh_try(pSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5144,24 +7243,23 @@ RcppExport SEXP _extraDistr_cpp_qprop(SEXP pSEXP, SEXP sizeSEXP, SEXP meanSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rprop
-NumericVector cpp_rprop(const int& n, const NumericVector& size, const NumericVector& mean, const NumericVector& prior);
-static SEXP _extraDistr_cpp_rprop_try(SEXP nSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP) {
+// cpp_rrayleigh
+NumericVector cpp_rrayleigh(const int& n, const NumericVector& sigma, const bool& sorted);
+static SEXP _extraDistr_cpp_rrayleigh_try(SEXP nSEXP, SEXP sigmaSEXP, SEXP sortedSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type mean(meanSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type prior(priorSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rprop(n, size, mean, prior));
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rrayleigh(n, sigma, sorted));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rprop(SEXP nSEXP, SEXP sizeSEXP, SEXP meanSEXP, SEXP priorSEXP) {
+RcppExport SEXP _extraDistr_cpp_rrayleigh(SEXP nSEXP, SEXP sigmaSEXP, SEXP sortedSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rprop_try(nSEXP, sizeSEXP, meanSEXP, priorSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rrayleigh_try(nSEXP, sigmaSEXP, sortedSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5181,21 +7279,24 @@ RcppExport SEXP _extraDistr_cpp_rprop(SEXP nSEXP, SEXP sizeSEXP, SEXP meanSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rsign
-NumericVector cpp_rsign(const int& n);
-static SEXP _extraDistr_cpp_rsign_try(SEXP nSEXP) {
+// cpp_rextreme_rayleigh
+NumericVector cpp_rextreme_rayleigh(const int& n, const NumericVector& size, const NumericVector& sigma, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_rayleigh_try(SEXP nSEXP, SEXP sizeSEXP, SEXP sigmaSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rsign(n));
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_rayleigh(n, size, sigma, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rsign(SEXP nSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_rayleigh(SEXP nSEXP, SEXP sizeSEXP, SEXP sigmaSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rsign_try(nSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_rayleigh_try(nSEXP, sizeSEXP, sigmaSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5215,23 +7316,24 @@ RcppExport SEXP _extraDistr_cpp_rsign(SEXP nSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_drayleigh
-NumericVector cpp_drayleigh(const NumericVector& x, const NumericVector& sigma, const bool& log_prob);
-static SEXP _extraDistr_cpp_drayleigh_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+// cpp_dcens_rayleigh
+NumericVector cpp_dcens_rayleigh(const NumericVector& x, const NumericVector& status, const NumericVector& sigma, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_rayleigh_try(SEXP xSEXP, SEXP statusSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_drayleigh(x, sigma, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_rayleigh(x, status, sigma, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_drayleigh(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dcens_rayleigh(SEXP xSEXP, SEXP statusSEXP, SEXP sigmaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_drayleigh_try(xSEXP, sigmaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_rayleigh_try(xSEXP, statusSEXP, sigmaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5251,24 +7353,24 @@ RcppExport SEXP _extraDistr_cpp_drayleigh(SEXP xSEXP, SEXP sigmaSEXP, SEXP log_p
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_prayleigh
-NumericVector cpp_prayleigh(const NumericVector& x, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_prayleigh_try(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dsgomp
+NumericVector cpp_dsgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, bool log_prob);
+static SEXP _extraDistr_cpp_dsgomp_try(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_prayleigh(x, sigma, lower_tail, log_prob));
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type eta(etaSEXP);
+    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dsgomp(x, b, eta, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_prayleigh(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dsgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_prayleigh_try(xSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dsgomp_try(xSEXP, bSEXP, etaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5288,24 +7390,25 @@ RcppExport SEXP _extraDistr_cpp_prayleigh(SEXP xSEXP, SEXP sigmaSEXP, SEXP lower
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_qrayleigh
-NumericVector cpp_qrayleigh(const NumericVector& p, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_qrayleigh_try(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_psgomp
+NumericVector cpp_psgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_psgomp_try(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type eta(etaSEXP);
     Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_qrayleigh(p, sigma, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_psgomp(x, b, eta, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_qrayleigh(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_psgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_qrayleigh_try(pSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_psgomp_try(xSEXP, bSEXP, etaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5325,22 +7428,25 @@ RcppExport SEXP _extraDistr_cpp_qrayleigh(SEXP pSEXP, SEXP sigmaSEXP, SEXP lower
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rrayleigh
-NumericVector cpp_rrayleigh(const int& n, const NumericVector& sigma);
-static SEXP _extraDistr_cpp_rrayleigh_try(SEXP nSEXP, SEXP sigmaSEXP) {
+// cpp_qsgomp
+NumericVector cpp_qsgomp(const NumericVector& p, const NumericVector& b, const NumericVector& eta, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qsgomp_try(SEXP pSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
-    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rrayleigh(n, sigma));
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type eta(etaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qsgomp(p, b, eta, lower_tail, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rrayleigh(SEXP nSEXP, SEXP sigmaSEXP) {
+RcppExport SEXP _extraDistr_cpp_qsgomp(SEXP pSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rrayleigh_try(nSEXP, sigmaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qsgomp_try(pSEXP, bSEXP, etaSEXP, lower_tailSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5360,24 +7466,23 @@ RcppExport SEXP _extraDistr_cpp_rrayleigh(SEXP nSEXP, SEXP sigmaSEXP) {
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_dsgomp
-NumericVector cpp_dsgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, bool log_prob);
-static SEXP _extraDistr_cpp_dsgomp_try(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
+// cpp_rsgomp
+NumericVector cpp_rsgomp(const int& n, const NumericVector& b, const NumericVector& eta);
+static SEXP _extraDistr_cpp_rsgomp_try(SEXP nSEXP, SEXP bSEXP, SEXP etaSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type eta(etaSEXP);
-    Rcpp::traits::input_parameter< bool >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_dsgomp(x, b, eta, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_rsgomp(n, b, eta));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_dsgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_rsgomp(SEXP nSEXP, SEXP bSEXP, SEXP etaSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_dsgomp_try(xSEXP, bSEXP, etaSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rsgomp_try(nSEXP, bSEXP, etaSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5397,25 +7502,25 @@ RcppExport SEXP _extraDistr_cpp_dsgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_psgomp
-NumericVector cpp_psgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, const bool& lower_tail, const bool& log_prob);
-static SEXP _extraDistr_cpp_psgomp_try(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+// cpp_dcens_sgomp
+NumericVector cpp_dcens_sgomp(const NumericVector& x, const NumericVector& status, const NumericVector& b, const NumericVector& eta, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_sgomp_try(SEXP xSEXP, SEXP statusSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type eta(etaSEXP);
-    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
     Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_psgomp(x, b, eta, lower_tail, log_prob));
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_sgomp(x, status, b, eta, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_psgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+RcppExport SEXP _extraDistr_cpp_dcens_sgomp(SEXP xSEXP, SEXP statusSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_psgomp_try(xSEXP, bSEXP, etaSEXP, lower_tailSEXP, log_probSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_sgomp_try(xSEXP, statusSEXP, bSEXP, etaSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5435,23 +7540,25 @@ RcppExport SEXP _extraDistr_cpp_psgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEX
     UNPROTECT(1);
     return rcpp_result_gen;
 }
-// cpp_rsgomp
-NumericVector cpp_rsgomp(const int& n, const NumericVector& b, const NumericVector& eta);
-static SEXP _extraDistr_cpp_rsgomp_try(SEXP nSEXP, SEXP bSEXP, SEXP etaSEXP) {
+// cpp_hazard_sgomp
+NumericVector cpp_hazard_sgomp(const NumericVector& x, const NumericVector& b, const NumericVector& eta, const bool& cumulative, const bool& log_prob);
+static SEXP _extraDistr_cpp_hazard_sgomp_try(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
-    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type b(bSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type eta(etaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rsgomp(n, b, eta));
+    Rcpp::traits::input_parameter< const bool& >::type cumulative(cumulativeSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_hazard_sgomp(x, b, eta, cumulative, log_prob));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rsgomp(SEXP nSEXP, SEXP bSEXP, SEXP etaSEXP) {
+RcppExport SEXP _extraDistr_cpp_hazard_sgomp(SEXP xSEXP, SEXP bSEXP, SEXP etaSEXP, SEXP cumulativeSEXP, SEXP log_probSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rsgomp_try(nSEXP, bSEXP, etaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_hazard_sgomp_try(xSEXP, bSEXP, etaSEXP, cumulativeSEXP, log_probSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -5619,6 +7726,44 @@ RcppExport SEXP _extraDistr_cpp_pslash(SEXP xSEXP, SEXP muSEXP, SEXP sigmaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_qslash
+NumericVector cpp_qslash(const NumericVector& p, const NumericVector& mu, const NumericVector& sigma, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qslash_try(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type sigma(sigmaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qslash(p, mu, sigma, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qslash(SEXP pSEXP, SEXP muSEXP, SEXP sigmaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qslash_try(pSEXP, muSEXP, sigmaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_rslash
 NumericVector cpp_rslash(const int& n, const NumericVector& mu, const NumericVector& sigma);
 static SEXP _extraDistr_cpp_rslash_try(SEXP nSEXP, SEXP muSEXP, SEXP sigmaSEXP) {
@@ -6313,21 +8458,59 @@ RcppExport SEXP _extraDistr_cpp_qtlambda(SEXP pSEXP, SEXP lambdaSEXP, SEXP lower
     return rcpp_result_gen;
 }
 // cpp_rtlambda
-NumericVector cpp_rtlambda(const int& n, const NumericVector& lambda);
-static SEXP _extraDistr_cpp_rtlambda_try(SEXP nSEXP, SEXP lambdaSEXP) {
+NumericVector cpp_rtlambda(const int& n, const NumericVector& lambda, const bool& sorted);
+static SEXP _extraDistr_cpp_rtlambda_try(SEXP nSEXP, SEXP lambdaSEXP, SEXP sortedSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type sorted(sortedSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rtlambda(n, lambda, sorted));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_rtlambda(SEXP nSEXP, SEXP lambdaSEXP, SEXP sortedSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rtlambda_try(nSEXP, lambdaSEXP, sortedSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
+// cpp_rextreme_tlambda
+NumericVector cpp_rextreme_tlambda(const int& n, const NumericVector& size, const NumericVector& lambda, const bool& minimum);
+static SEXP _extraDistr_cpp_rextreme_tlambda_try(SEXP nSEXP, SEXP sizeSEXP, SEXP lambdaSEXP, SEXP minimumSEXP) {
 BEGIN_RCPP
     Rcpp::RObject rcpp_result_gen;
     Rcpp::traits::input_parameter< const int& >::type n(nSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type size(sizeSEXP);
     Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
-    rcpp_result_gen = Rcpp::wrap(cpp_rtlambda(n, lambda));
+    Rcpp::traits::input_parameter< const bool& >::type minimum(minimumSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_rextreme_tlambda(n, size, lambda, minimum));
     return rcpp_result_gen;
 END_RCPP_RETURN_ERROR
 }
-RcppExport SEXP _extraDistr_cpp_rtlambda(SEXP nSEXP, SEXP lambdaSEXP) {
+RcppExport SEXP _extraDistr_cpp_rextreme_tlambda(SEXP nSEXP, SEXP sizeSEXP, SEXP lambdaSEXP, SEXP minimumSEXP) {
     SEXP rcpp_result_gen;
     {
         Rcpp::RNGScope rcpp_rngScope_gen;
-        rcpp_result_gen = PROTECT(_extraDistr_cpp_rtlambda_try(nSEXP, lambdaSEXP));
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_rextreme_tlambda_try(nSEXP, sizeSEXP, lambdaSEXP, minimumSEXP));
     }
     Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
     if (rcpp_isInterrupt_gen) {
@@ -6422,6 +8605,44 @@ RcppExport SEXP _extraDistr_cpp_pwald(SEXP xSEXP, SEXP muSEXP, SEXP lambdaSEXP,
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_qwald
+NumericVector cpp_qwald(const NumericVector& p, const NumericVector& mu, const NumericVector& lambda, const bool& lower_tail, const bool& log_prob);
+static SEXP _extraDistr_cpp_qwald_try(SEXP pSEXP, SEXP muSEXP, SEXP lambdaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type p(pSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type lower_tail(lower_tailSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_qwald(p, mu, lambda, lower_tail, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_qwald(SEXP pSEXP, SEXP muSEXP, SEXP lambdaSEXP, SEXP lower_tailSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_qwald_try(pSEXP, muSEXP, lambdaSEXP, lower_tailSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_rwald
 NumericVector cpp_rwald(const int& n, const NumericVector& mu, const NumericVector& lambda);
 static SEXP _extraDistr_cpp_rwald_try(SEXP nSEXP, SEXP muSEXP, SEXP lambdaSEXP) {
@@ -6458,6 +8679,44 @@ RcppExport SEXP _extraDistr_cpp_rwald(SEXP nSEXP, SEXP muSEXP, SEXP lambdaSEXP)
     UNPROTECT(1);
     return rcpp_result_gen;
 }
+// cpp_dcens_wald
+NumericVector cpp_dcens_wald(const NumericVector& x, const NumericVector& status, const NumericVector& mu, const NumericVector& lambda, const bool& log_prob);
+static SEXP _extraDistr_cpp_dcens_wald_try(SEXP xSEXP, SEXP statusSEXP, SEXP muSEXP, SEXP lambdaSEXP, SEXP log_probSEXP) {
+BEGIN_RCPP
+    Rcpp::RObject rcpp_result_gen;
+    Rcpp::traits::input_parameter< const NumericVector& >::type x(xSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type status(statusSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type mu(muSEXP);
+    Rcpp::traits::input_parameter< const NumericVector& >::type lambda(lambdaSEXP);
+    Rcpp::traits::input_parameter< const bool& >::type log_prob(log_probSEXP);
+    rcpp_result_gen = Rcpp::wrap(cpp_dcens_wald(x, status, mu, lambda, log_prob));
+    return rcpp_result_gen;
+END_RCPP_RETURN_ERROR
+}
+RcppExport SEXP _extraDistr_cpp_dcens_wald(SEXP xSEXP, SEXP statusSEXP, SEXP muSEXP, SEXP lambdaSEXP, SEXP log_probSEXP) {
+    SEXP rcpp_result_gen;
+    {
+        Rcpp::RNGScope rcpp_rngScope_gen;
+        rcpp_result_gen = PROTECT(_extraDistr_cpp_dcens_wald_try(xSEXP, statusSEXP, muSEXP, lambdaSEXP, log_probSEXP));
+    }
+    Rboolean rcpp_isInterrupt_gen = Rf_inherits(rcpp_result_gen, "interrupted-error");
+    if (rcpp_isInterrupt_gen) {
+        UNPROTECT(1);
+        Rf_onintr();
+    }
+    bool rcpp_isLongjump_gen = Rcpp::internal::isLongjumpSentinel(rcpp_result_gen);
+    if (rcpp_isLongjump_gen) {
+        Rcpp::internal::resumeJump(rcpp_result_gen);
+    }
+    Rboolean rcpp_isError_gen = Rf_inherits(rcpp_result_gen, "try-error");
+    if (rcpp_isError_gen) {
+        SEXP rcpp_msgSEXP_gen = Rf_asChar(rcpp_result_gen);
+        UNPROTECT(1);
+        Rf_error("%s", CHAR(rcpp_msgSEXP_gen));
+    }
+    UNPROTECT(1);
+    return rcpp_result_gen;
+}
 // cpp_dzib
 NumericVector cpp_dzib(const NumericVector& x, const NumericVector& size, const NumericVector& prob, const NumericVector& pi, const bool& log_prob);
 static SEXP _extraDistr_cpp_dzib_try(SEXP xSEXP, SEXP sizeSEXP, SEXP probSEXP, SEXP piSEXP, SEXP log_probSEXP) {
@@ -6934,11 +9193,14 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_rbetapr)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dbhatt)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pbhatt)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qbhatt)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rbhatt)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dfatigue)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pfatigue)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qfatigue)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rfatigue)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_dcens_fatigue)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_fatigue)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dbnorm)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericMatrix(*cpp_rbnorm)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dbpois)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
@@ -6948,11 +9210,15 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_pcat)(const NumericVector&,const NumericMatrix&,bool,bool)");
         signatures.insert("NumericVector(*cpp_qcat)(const NumericVector&,const NumericMatrix&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rcat)(const int&,const NumericMatrix&)");
+        signatures.insert("NumericMatrix(*cpp_rcopula)(const int&,const NumericMatrix&,const CharacterVector&,const NumericMatrix&,const double&)");
         signatures.insert("NumericVector(*cpp_ddirichlet)(const NumericMatrix&,const NumericMatrix&,const bool&)");
         signatures.insert("NumericMatrix(*cpp_rdirichlet)(const int&,const NumericMatrix&)");
         signatures.insert("NumericVector(*cpp_ddirmnom)(const NumericMatrix&,const NumericVector&,const NumericMatrix&,const bool&)");
         signatures.insert("NumericMatrix(*cpp_rdirmnom)(const int&,const NumericVector&,const NumericMatrix&)");
         signatures.insert("NumericVector(*cpp_ddgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_pdgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qdgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rdgamma)(const int&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_ddlaplace)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pdlaplace)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rdlaplace)(const int&,const NumericVector&,const NumericVector&)");
@@ -6964,30 +9230,54 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_ddweibull)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pdweibull)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qdweibull)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rdweibull)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rdweibull)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_dcens_dweibull)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_dmix)(const NumericVector&,const CharacterVector&,const NumericMatrix&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_pmix)(const NumericVector&,const CharacterVector&,const NumericMatrix&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qmix)(const NumericVector&,const CharacterVector&,const NumericMatrix&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rmix)(const int&,const CharacterVector&,const NumericMatrix&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dfrechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pfrechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qfrechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rfrechet)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rfrechet)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_frechet)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_pfrechet_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_dcens_frechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_frechet)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dgpois)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pgpois)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rgpois)(const int&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dgev)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pgev)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,bool,bool)");
         signatures.insert("NumericVector(*cpp_qgev)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,bool,bool)");
-        signatures.insert("NumericVector(*cpp_rgev)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rgev)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_gev)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericMatrix(*cpp_dgev_outer)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericMatrix(*cpp_pgev_outer)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_pgev_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_gev)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,bool)");
         signatures.insert("NumericVector(*cpp_pgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qgompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rgompertz)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rgompertz)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_gompertz)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_dcens_gompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_gompertz)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dgpd)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pgpd)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qgpd)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rgpd)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rgpd)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_gpd)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_pgpd_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_gpd)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("Rcpp::List(*cpp_gpd_threshold)(const Rcpp::List&,const NumericVector&,const int&,const int&,const double&)");
         signatures.insert("NumericVector(*cpp_dgumbel)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pgumbel)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qgumbel)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rgumbel)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rgumbel)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_gumbel)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_pgumbel_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_gumbel)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dhcauchy)(const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_phcauchy)(const NumericVector&,const NumericVector&,bool,bool)");
         signatures.insert("NumericVector(*cpp_qhcauchy)(const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7003,13 +9293,20 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_dhuber)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_phuber)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qhuber)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rhuber)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rhuber)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_huber)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_huber_rho)(const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_huber_psi)(const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_huber_weight)(const NumericVector&,const NumericVector&)");
+        signatures.insert("double(*cpp_huber_scale)(const NumericVector&,const double&,const bool&,const int&,const double&)");
+        signatures.insert("Rcpp::List(*cpp_huber_irls)(const NumericMatrix&,const NumericVector&,const double&,const bool&,const int&,const double&)");
         signatures.insert("NumericVector(*cpp_dinvgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pinvgamma)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dkumar)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pkumar)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qkumar)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rkumar)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rkumar)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_kumar)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_dlaplace)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_plaplace)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qlaplace)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7025,7 +9322,11 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_dlomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_plomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qlomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rlomax)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rlomax)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_lomax)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_plomax_interval)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_dcens_lomax)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_lomax)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dmixnorm)(const NumericVector&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const bool&)");
         signatures.insert("NumericVector(*cpp_pmixnorm)(const NumericVector&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rmixnorm)(const int&,const NumericMatrix&,const NumericMatrix&,const NumericMatrix&)");
@@ -7036,6 +9337,8 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericMatrix(*cpp_rmnom)(const int&,const NumericVector&,const NumericMatrix&)");
         signatures.insert("NumericVector(*cpp_dmvhyper)(const NumericMatrix&,const NumericMatrix&,const NumericVector&,const bool&)");
         signatures.insert("NumericMatrix(*cpp_rmvhyper)(const int&,const NumericMatrix&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_dmvnorm)(const NumericMatrix&,const NumericMatrix&,const NumericVector&,const bool&)");
+        signatures.insert("NumericMatrix(*cpp_rmvnorm)(const int&,const NumericMatrix&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dnhyper)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pnhyper)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qnhyper)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7047,27 +9350,39 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_dpareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_ppareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qpareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rpareto)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rpareto)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_pareto)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_dcens_pareto)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_pareto)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dpower)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_ppower)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qpower)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rpower)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rpower)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_power)(const int&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_dprop)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pprop)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qprop)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rprop)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_qapprox_cheb)(const NumericVector&,const NumericVector&,const NumericMatrix&,const IntegerVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qapprox_disc)(const NumericVector&,const NumericVector&,const double&,const double&,const double&,const IntegerVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rsign)(const int&)");
         signatures.insert("NumericVector(*cpp_drayleigh)(const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_prayleigh)(const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qrayleigh)(const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rrayleigh)(const int&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rrayleigh)(const int&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_rayleigh)(const int&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_dcens_rayleigh)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_dsgomp)(const NumericVector&,const NumericVector&,const NumericVector&,bool)");
         signatures.insert("NumericVector(*cpp_psgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qsgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rsgomp)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_dcens_sgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_hazard_sgomp)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_dskellam)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_rskellam)(const int&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dslash)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pslash)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qslash)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rslash)(const int&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_dtriang)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_ptriang)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7086,10 +9401,13 @@ static int _extraDistr_RcppExport_validate(const char* sig) {
         signatures.insert("NumericVector(*cpp_qtpois)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rtpois)(const int&,const NumericVector&,const NumericVector&,const NumericVector&)");
         signatures.insert("NumericVector(*cpp_qtlambda)(const NumericVector&,const NumericVector&,const bool&,const bool&)");
-        signatures.insert("NumericVector(*cpp_rtlambda)(const int&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_rtlambda)(const int&,const NumericVector&,const bool&)");
+        signatures.insert("NumericVector(*cpp_rextreme_tlambda)(const int&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_dwald)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pwald)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
+        signatures.insert("NumericVector(*cpp_qwald)(const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_rwald)(const int&,const NumericVector&,const NumericVector&)");
+        signatures.insert("NumericVector(*cpp_dcens_wald)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_dzib)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&)");
         signatures.insert("NumericVector(*cpp_pzib)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
         signatures.insert("NumericVector(*cpp_qzib)(const NumericVector&,const NumericVector&,const NumericVector&,const NumericVector&,const bool&,const bool&)");
@@ -7124,11 +9442,14 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rbetapr", (DL_FUNC)_extraDistr_cpp_rbetapr_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dbhatt", (DL_FUNC)_extraDistr_cpp_dbhatt_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pbhatt", (DL_FUNC)_extraDistr_cpp_pbhatt_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qbhatt", (DL_FUNC)_extraDistr_cpp_qbhatt_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rbhatt", (DL_FUNC)_extraDistr_cpp_rbhatt_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dfatigue", (DL_FUNC)_extraDistr_cpp_dfatigue_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pfatigue", (DL_FUNC)_extraDistr_cpp_pfatigue_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qfatigue", (DL_FUNC)_extraDistr_cpp_qfatigue_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rfatigue", (DL_FUNC)_extraDistr_cpp_rfatigue_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_fatigue", (DL_FUNC)_extraDistr_cpp_dcens_fatigue_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_fatigue", (DL_FUNC)_extraDistr_cpp_hazard_fatigue_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dbnorm", (DL_FUNC)_extraDistr_cpp_dbnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rbnorm", (DL_FUNC)_extraDistr_cpp_rbnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dbpois", (DL_FUNC)_extraDistr_cpp_dbpois_try);
@@ -7138,11 +9459,15 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pcat", (DL_FUNC)_extraDistr_cpp_pcat_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qcat", (DL_FUNC)_extraDistr_cpp_qcat_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rcat", (DL_FUNC)_extraDistr_cpp_rcat_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rcopula", (DL_FUNC)_extraDistr_cpp_rcopula_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ddirichlet", (DL_FUNC)_extraDistr_cpp_ddirichlet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rdirichlet", (DL_FUNC)_extraDistr_cpp_rdirichlet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ddirmnom", (DL_FUNC)_extraDistr_cpp_ddirmnom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rdirmnom", (DL_FUNC)_extraDistr_cpp_rdirmnom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ddgamma", (DL_FUNC)_extraDistr_cpp_ddgamma_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pdgamma", (DL_FUNC)_extraDistr_cpp_pdgamma_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qdgamma", (DL_FUNC)_extraDistr_cpp_qdgamma_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rdgamma", (DL_FUNC)_extraDistr_cpp_rdgamma_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ddlaplace", (DL_FUNC)_extraDistr_cpp_ddlaplace_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pdlaplace", (DL_FUNC)_extraDistr_cpp_pdlaplace_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rdlaplace", (DL_FUNC)_extraDistr_cpp_rdlaplace_try);
@@ -7155,10 +9480,19 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pdweibull", (DL_FUNC)_extraDistr_cpp_pdweibull_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qdweibull", (DL_FUNC)_extraDistr_cpp_qdweibull_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rdweibull", (DL_FUNC)_extraDistr_cpp_rdweibull_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_dweibull", (DL_FUNC)_extraDistr_cpp_dcens_dweibull_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dmix", (DL_FUNC)_extraDistr_cpp_dmix_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pmix", (DL_FUNC)_extraDistr_cpp_pmix_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qmix", (DL_FUNC)_extraDistr_cpp_qmix_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmix", (DL_FUNC)_extraDistr_cpp_rmix_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dfrechet", (DL_FUNC)_extraDistr_cpp_dfrechet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pfrechet", (DL_FUNC)_extraDistr_cpp_pfrechet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qfrechet", (DL_FUNC)_extraDistr_cpp_qfrechet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rfrechet", (DL_FUNC)_extraDistr_cpp_rfrechet_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_frechet", (DL_FUNC)_extraDistr_cpp_rextreme_frechet_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pfrechet_interval", (DL_FUNC)_extraDistr_cpp_pfrechet_interval_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_frechet", (DL_FUNC)_extraDistr_cpp_dcens_frechet_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_frechet", (DL_FUNC)_extraDistr_cpp_hazard_frechet_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dgpois", (DL_FUNC)_extraDistr_cpp_dgpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgpois", (DL_FUNC)_extraDistr_cpp_pgpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rgpois", (DL_FUNC)_extraDistr_cpp_rgpois_try);
@@ -7166,18 +9500,33 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgev", (DL_FUNC)_extraDistr_cpp_pgev_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qgev", (DL_FUNC)_extraDistr_cpp_qgev_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rgev", (DL_FUNC)_extraDistr_cpp_rgev_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_gev", (DL_FUNC)_extraDistr_cpp_rextreme_gev_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dgev_outer", (DL_FUNC)_extraDistr_cpp_dgev_outer_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgev_outer", (DL_FUNC)_extraDistr_cpp_pgev_outer_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgev_interval", (DL_FUNC)_extraDistr_cpp_pgev_interval_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_gev", (DL_FUNC)_extraDistr_cpp_hazard_gev_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dgompertz", (DL_FUNC)_extraDistr_cpp_dgompertz_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgompertz", (DL_FUNC)_extraDistr_cpp_pgompertz_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qgompertz", (DL_FUNC)_extraDistr_cpp_qgompertz_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rgompertz", (DL_FUNC)_extraDistr_cpp_rgompertz_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_gompertz", (DL_FUNC)_extraDistr_cpp_rextreme_gompertz_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_gompertz", (DL_FUNC)_extraDistr_cpp_dcens_gompertz_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_gompertz", (DL_FUNC)_extraDistr_cpp_hazard_gompertz_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dgpd", (DL_FUNC)_extraDistr_cpp_dgpd_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgpd", (DL_FUNC)_extraDistr_cpp_pgpd_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qgpd", (DL_FUNC)_extraDistr_cpp_qgpd_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rgpd", (DL_FUNC)_extraDistr_cpp_rgpd_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_gpd", (DL_FUNC)_extraDistr_cpp_rextreme_gpd_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgpd_interval", (DL_FUNC)_extraDistr_cpp_pgpd_interval_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_gpd", (DL_FUNC)_extraDistr_cpp_hazard_gpd_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_gpd_threshold", (DL_FUNC)_extraDistr_cpp_gpd_threshold_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dgumbel", (DL_FUNC)_extraDistr_cpp_dgumbel_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgumbel", (DL_FUNC)_extraDistr_cpp_pgumbel_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qgumbel", (DL_FUNC)_extraDistr_cpp_qgumbel_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rgumbel", (DL_FUNC)_extraDistr_cpp_rgumbel_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_gumbel", (DL_FUNC)_extraDistr_cpp_rextreme_gumbel_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pgumbel_interval", (DL_FUNC)_extraDistr_cpp_pgumbel_interval_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_gumbel", (DL_FUNC)_extraDistr_cpp_hazard_gumbel_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dhcauchy", (DL_FUNC)_extraDistr_cpp_dhcauchy_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_phcauchy", (DL_FUNC)_extraDistr_cpp_phcauchy_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qhcauchy", (DL_FUNC)_extraDistr_cpp_qhcauchy_try);
@@ -7194,12 +9543,19 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_phuber", (DL_FUNC)_extraDistr_cpp_phuber_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qhuber", (DL_FUNC)_extraDistr_cpp_qhuber_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rhuber", (DL_FUNC)_extraDistr_cpp_rhuber_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_huber", (DL_FUNC)_extraDistr_cpp_rextreme_huber_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_huber_rho", (DL_FUNC)_extraDistr_cpp_huber_rho_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_huber_psi", (DL_FUNC)_extraDistr_cpp_huber_psi_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_huber_weight", (DL_FUNC)_extraDistr_cpp_huber_weight_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_huber_scale", (DL_FUNC)_extraDistr_cpp_huber_scale_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_huber_irls", (DL_FUNC)_extraDistr_cpp_huber_irls_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dinvgamma", (DL_FUNC)_extraDistr_cpp_dinvgamma_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pinvgamma", (DL_FUNC)_extraDistr_cpp_pinvgamma_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dkumar", (DL_FUNC)_extraDistr_cpp_dkumar_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pkumar", (DL_FUNC)_extraDistr_cpp_pkumar_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qkumar", (DL_FUNC)_extraDistr_cpp_qkumar_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rkumar", (DL_FUNC)_extraDistr_cpp_rkumar_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_kumar", (DL_FUNC)_extraDistr_cpp_rextreme_kumar_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dlaplace", (DL_FUNC)_extraDistr_cpp_dlaplace_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_plaplace", (DL_FUNC)_extraDistr_cpp_plaplace_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qlaplace", (DL_FUNC)_extraDistr_cpp_qlaplace_try);
@@ -7216,6 +9572,10 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_plomax", (DL_FUNC)_extraDistr_cpp_plomax_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qlomax", (DL_FUNC)_extraDistr_cpp_qlomax_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rlomax", (DL_FUNC)_extraDistr_cpp_rlomax_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_lomax", (DL_FUNC)_extraDistr_cpp_rextreme_lomax_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_plomax_interval", (DL_FUNC)_extraDistr_cpp_plomax_interval_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_lomax", (DL_FUNC)_extraDistr_cpp_dcens_lomax_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_lomax", (DL_FUNC)_extraDistr_cpp_hazard_lomax_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dmixnorm", (DL_FUNC)_extraDistr_cpp_dmixnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pmixnorm", (DL_FUNC)_extraDistr_cpp_pmixnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmixnorm", (DL_FUNC)_extraDistr_cpp_rmixnorm_try);
@@ -7226,6 +9586,8 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmnom", (DL_FUNC)_extraDistr_cpp_rmnom_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dmvhyper", (DL_FUNC)_extraDistr_cpp_dmvhyper_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmvhyper", (DL_FUNC)_extraDistr_cpp_rmvhyper_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dmvnorm", (DL_FUNC)_extraDistr_cpp_dmvnorm_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rmvnorm", (DL_FUNC)_extraDistr_cpp_rmvnorm_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dnhyper", (DL_FUNC)_extraDistr_cpp_dnhyper_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pnhyper", (DL_FUNC)_extraDistr_cpp_pnhyper_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qnhyper", (DL_FUNC)_extraDistr_cpp_qnhyper_try);
@@ -7238,26 +9600,38 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ppareto", (DL_FUNC)_extraDistr_cpp_ppareto_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qpareto", (DL_FUNC)_extraDistr_cpp_qpareto_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rpareto", (DL_FUNC)_extraDistr_cpp_rpareto_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_pareto", (DL_FUNC)_extraDistr_cpp_rextreme_pareto_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_pareto", (DL_FUNC)_extraDistr_cpp_dcens_pareto_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_pareto", (DL_FUNC)_extraDistr_cpp_hazard_pareto_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dpower", (DL_FUNC)_extraDistr_cpp_dpower_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ppower", (DL_FUNC)_extraDistr_cpp_ppower_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qpower", (DL_FUNC)_extraDistr_cpp_qpower_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rpower", (DL_FUNC)_extraDistr_cpp_rpower_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_power", (DL_FUNC)_extraDistr_cpp_rextreme_power_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dprop", (DL_FUNC)_extraDistr_cpp_dprop_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pprop", (DL_FUNC)_extraDistr_cpp_pprop_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qprop", (DL_FUNC)_extraDistr_cpp_qprop_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rprop", (DL_FUNC)_extraDistr_cpp_rprop_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qapprox_cheb", (DL_FUNC)_extraDistr_cpp_qapprox_cheb_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qapprox_disc", (DL_FUNC)_extraDistr_cpp_qapprox_disc_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rsign", (DL_FUNC)_extraDistr_cpp_rsign_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_drayleigh", (DL_FUNC)_extraDistr_cpp_drayleigh_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_prayleigh", (DL_FUNC)_extraDistr_cpp_prayleigh_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qrayleigh", (DL_FUNC)_extraDistr_cpp_qrayleigh_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rrayleigh", (DL_FUNC)_extraDistr_cpp_rrayleigh_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_rayleigh", (DL_FUNC)_extraDistr_cpp_rextreme_rayleigh_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_rayleigh", (DL_FUNC)_extraDistr_cpp_dcens_rayleigh_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dsgomp", (DL_FUNC)_extraDistr_cpp_dsgomp_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_psgomp", (DL_FUNC)_extraDistr_cpp_psgomp_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qsgomp", (DL_FUNC)_extraDistr_cpp_qsgomp_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rsgomp", (DL_FUNC)_extraDistr_cpp_rsgomp_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_sgomp", (DL_FUNC)_extraDistr_cpp_dcens_sgomp_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_hazard_sgomp", (DL_FUNC)_extraDistr_cpp_hazard_sgomp_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dskellam", (DL_FUNC)_extraDistr_cpp_dskellam_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rskellam", (DL_FUNC)_extraDistr_cpp_rskellam_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dslash", (DL_FUNC)_extraDistr_cpp_dslash_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pslash", (DL_FUNC)_extraDistr_cpp_pslash_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qslash", (DL_FUNC)_extraDistr_cpp_qslash_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rslash", (DL_FUNC)_extraDistr_cpp_rslash_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dtriang", (DL_FUNC)_extraDistr_cpp_dtriang_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_ptriang", (DL_FUNC)_extraDistr_cpp_ptriang_try);
@@ -7277,9 +9651,12 @@ RcppExport SEXP _extraDistr_RcppExport_registerCCallable() {
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rtpois", (DL_FUNC)_extraDistr_cpp_rtpois_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qtlambda", (DL_FUNC)_extraDistr_cpp_qtlambda_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rtlambda", (DL_FUNC)_extraDistr_cpp_rtlambda_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rextreme_tlambda", (DL_FUNC)_extraDistr_cpp_rextreme_tlambda_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dwald", (DL_FUNC)_extraDistr_cpp_dwald_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pwald", (DL_FUNC)_extraDistr_cpp_pwald_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qwald", (DL_FUNC)_extraDistr_cpp_qwald_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_rwald", (DL_FUNC)_extraDistr_cpp_rwald_try);
+    R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dcens_wald", (DL_FUNC)_extraDistr_cpp_dcens_wald_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_dzib", (DL_FUNC)_extraDistr_cpp_dzib_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_pzib", (DL_FUNC)_extraDistr_cpp_pzib_try);
     R_RegisterCCallable("extraDistr", "_extraDistr_cpp_qzib", (DL_FUNC)_extraDistr_cpp_qzib_try);
@@ -7313,11 +9690,14 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_rbetapr", (DL_FUNC) &_extraDistr_cpp_rbetapr, 4},
     {"_extraDistr_cpp_dbhatt", (DL_FUNC) &_extraDistr_cpp_dbhatt, 5},
     {"_extraDistr_cpp_pbhatt", (DL_FUNC) &_extraDistr_cpp_pbhatt, 6},
+    {"_extraDistr_cpp_qbhatt", (DL_FUNC) &_extraDistr_cpp_qbhatt, 6},
     {"_extraDistr_cpp_rbhatt", (DL_FUNC) &_extraDistr_cpp_rbhatt, 4},
     {"_extraDistr_cpp_dfatigue", (DL_FUNC) &_extraDistr_cpp_dfatigue, 5},
     {"_extraDistr_cpp_pfatigue", (DL_FUNC) &_extraDistr_cpp_pfatigue, 6},
     {"_extraDistr_cpp_qfatigue", (DL_FUNC) &_extraDistr_cpp_qfatigue, 6},
     {"_extraDistr_cpp_rfatigue", (DL_FUNC) &_extraDistr_cpp_rfatigue, 4},
+    {"_extraDistr_cpp_dcens_fatigue", (DL_FUNC) &_extraDistr_cpp_dcens_fatigue, 6},
+    {"_extraDistr_cpp_hazard_fatigue", (DL_FUNC) &_extraDistr_cpp_hazard_fatigue, 6},
     {"_extraDistr_cpp_dbnorm", (DL_FUNC) &_extraDistr_cpp_dbnorm, 8},
     {"_extraDistr_cpp_rbnorm", (DL_FUNC) &_extraDistr_cpp_rbnorm, 6},
     {"_extraDistr_cpp_dbpois", (DL_FUNC) &_extraDistr_cpp_dbpois, 6},
@@ -7327,11 +9707,15 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_pcat", (DL_FUNC) &_extraDistr_cpp_pcat, 4},
     {"_extraDistr_cpp_qcat", (DL_FUNC) &_extraDistr_cpp_qcat, 4},
     {"_extraDistr_cpp_rcat", (DL_FUNC) &_extraDistr_cpp_rcat, 2},
+    {"_extraDistr_cpp_rcopula", (DL_FUNC) &_extraDistr_cpp_rcopula, 5},
     {"_extraDistr_cpp_ddirichlet", (DL_FUNC) &_extraDistr_cpp_ddirichlet, 3},
     {"_extraDistr_cpp_rdirichlet", (DL_FUNC) &_extraDistr_cpp_rdirichlet, 2},
     {"_extraDistr_cpp_ddirmnom", (DL_FUNC) &_extraDistr_cpp_ddirmnom, 4},
     {"_extraDistr_cpp_rdirmnom", (DL_FUNC) &_extraDistr_cpp_rdirmnom, 3},
     {"_extraDistr_cpp_ddgamma", (DL_FUNC) &_extraDistr_cpp_ddgamma, 4},
+    {"_extraDistr_cpp_pdgamma", (DL_FUNC) &_extraDistr_cpp_pdgamma, 5},
+    {"_extraDistr_cpp_qdgamma", (DL_FUNC) &_extraDistr_cpp_qdgamma, 5},
+    {"_extraDistr_cpp_rdgamma", (DL_FUNC) &_extraDistr_cpp_rdgamma, 3},
     {"_extraDistr_cpp_ddlaplace", (DL_FUNC) &_extraDistr_cpp_ddlaplace, 4},
     {"_extraDistr_cpp_pdlaplace", (DL_FUNC) &_extraDistr_cpp_pdlaplace, 5},
     {"_extraDistr_cpp_rdlaplace", (DL_FUNC) &_extraDistr_cpp_rdlaplace, 3},
@@ -7343,30 +9727,54 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_ddweibull", (DL_FUNC) &_extraDistr_cpp_ddweibull, 4},
     {"_extraDistr_cpp_pdweibull", (DL_FUNC) &_extraDistr_cpp_pdweibull, 5},
     {"_extraDistr_cpp_qdweibull", (DL_FUNC) &_extraDistr_cpp_qdweibull, 5},
-    {"_extraDistr_cpp_rdweibull", (DL_FUNC) &_extraDistr_cpp_rdweibull, 3},
+    {"_extraDistr_cpp_rdweibull", (DL_FUNC) &_extraDistr_cpp_rdweibull, 4},
+    {"_extraDistr_cpp_dcens_dweibull", (DL_FUNC) &_extraDistr_cpp_dcens_dweibull, 5},
+    {"_extraDistr_cpp_dmix", (DL_FUNC) &_extraDistr_cpp_dmix, 5},
+    {"_extraDistr_cpp_pmix", (DL_FUNC) &_extraDistr_cpp_pmix, 6},
+    {"_extraDistr_cpp_qmix", (DL_FUNC) &_extraDistr_cpp_qmix, 6},
+    {"_extraDistr_cpp_rmix", (DL_FUNC) &_extraDistr_cpp_rmix, 4},
     {"_extraDistr_cpp_dfrechet", (DL_FUNC) &_extraDistr_cpp_dfrechet, 5},
     {"_extraDistr_cpp_pfrechet", (DL_FUNC) &_extraDistr_cpp_pfrechet, 6},
     {"_extraDistr_cpp_qfrechet", (DL_FUNC) &_extraDistr_cpp_qfrechet, 6},
-    {"_extraDistr_cpp_rfrechet", (DL_FUNC) &_extraDistr_cpp_rfrechet, 4},
+    {"_extraDistr_cpp_rfrechet", (DL_FUNC) &_extraDistr_cpp_rfrechet, 5},
+    {"_extraDistr_cpp_rextreme_frechet", (DL_FUNC) &_extraDistr_cpp_rextreme_frechet, 6},
+    {"_extraDistr_cpp_pfrechet_interval", (DL_FUNC) &_extraDistr_cpp_pfrechet_interval, 6},
+    {"_extraDistr_cpp_dcens_frechet", (DL_FUNC) &_extraDistr_cpp_dcens_frechet, 6},
+    {"_extraDistr_cpp_hazard_frechet", (DL_FUNC) &_extraDistr_cpp_hazard_frechet, 6},
     {"_extraDistr_cpp_dgpois", (DL_FUNC) &_extraDistr_cpp_dgpois, 4},
     {"_extraDistr_cpp_pgpois", (DL_FUNC) &_extraDistr_cpp_pgpois, 5},
     {"_extraDistr_cpp_rgpois", (DL_FUNC) &_extraDistr_cpp_rgpois, 3},
     {"_extraDistr_cpp_dgev", (DL_FUNC) &_extraDistr_cpp_dgev, 5},
     {"_extraDistr_cpp_pgev", (DL_FUNC) &_extraDistr_cpp_pgev, 6},
     {"_extraDistr_cpp_qgev", (DL_FUNC) &_extraDistr_cpp_qgev, 6},
-    {"_extraDistr_cpp_rgev", (DL_FUNC) &_extraDistr_cpp_rgev, 4},
+    {"_extraDistr_cpp_rgev", (DL_FUNC) &_extraDistr_cpp_rgev, 5},
+    {"_extraDistr_cpp_rextreme_gev", (DL_FUNC) &_extraDistr_cpp_rextreme_gev, 6},
+    {"_extraDistr_cpp_dgev_outer", (DL_FUNC) &_extraDistr_cpp_dgev_outer, 5},
+    {"_extraDistr_cpp_pgev_outer", (DL_FUNC) &_extraDistr_cpp_pgev_outer, 6},
+    {"_extraDistr_cpp_pgev_interval", (DL_FUNC) &_extraDistr_cpp_pgev_interval, 6},
+    {"_extraDistr_cpp_hazard_gev", (DL_FUNC) &_extraDistr_cpp_hazard_gev, 6},
     {"_extraDistr_cpp_dgompertz", (DL_FUNC) &_extraDistr_cpp_dgompertz, 4},
     {"_extraDistr_cpp_pgompertz", (DL_FUNC) &_extraDistr_cpp_pgompertz, 5},
     {"_extraDistr_cpp_qgompertz", (DL_FUNC) &_extraDistr_cpp_qgompertz, 5},
-    {"_extraDistr_cpp_rgompertz", (DL_FUNC) &_extraDistr_cpp_rgompertz, 3},
+    {"_extraDistr_cpp_rgompertz", (DL_FUNC) &_extraDistr_cpp_rgompertz, 4},
+    {"_extraDistr_cpp_rextreme_gompertz", (DL_FUNC) &_extraDistr_cpp_rextreme_gompertz, 5},
+    {"_extraDistr_cpp_dcens_gompertz", (DL_FUNC) &_extraDistr_cpp_dcens_gompertz, 5},
+    {"_extraDistr_cpp_hazard_gompertz", (DL_FUNC) &_extraDistr_cpp_hazard_gompertz, 5},
     {"_extraDistr_cpp_dgpd", (DL_FUNC) &_extraDistr_cpp_dgpd, 5},
     {"_extraDistr_cpp_pgpd", (DL_FUNC) &_extraDistr_cpp_pgpd, 6},
     {"_extraDistr_cpp_qgpd", (DL_FUNC) &_extraDistr_cpp_qgpd, 6},
-    {"_extraDistr_cpp_rgpd", (DL_FUNC) &_extraDistr_cpp_rgpd, 4},
+    {"_extraDistr_cpp_rgpd", (DL_FUNC) &_extraDistr_cpp_rgpd, 5},
+    {"_extraDistr_cpp_rextreme_gpd", (DL_FUNC) &_extraDistr_cpp_rextreme_gpd, 6},
+    {"_extraDistr_cpp_pgpd_interval", (DL_FUNC) &_extraDistr_cpp_pgpd_interval, 6},
+    {"_extraDistr_cpp_hazard_gpd", (DL_FUNC) &_extraDistr_cpp_hazard_gpd, 6},
+    {"_extraDistr_cpp_gpd_threshold", (DL_FUNC) &_extraDistr_cpp_gpd_threshold, 5},
     {"_extraDistr_cpp_dgumbel", (DL_FUNC) &_extraDistr_cpp_dgumbel, 4},
     {"_extraDistr_cpp_pgumbel", (DL_FUNC) &_extraDistr_cpp_pgumbel, 5},
     {"_extraDistr_cpp_qgumbel", (DL_FUNC) &_extraDistr_cpp_qgumbel, 5},
-    {"_extraDistr_cpp_rgumbel", (DL_FUNC) &_extraDistr_cpp_rgumbel, 3},
+    {"_extraDistr_cpp_rgumbel", (DL_FUNC) &_extraDistr_cpp_rgumbel, 4},
+    {"_extraDistr_cpp_rextreme_gumbel", (DL_FUNC) &_extraDistr_cpp_rextreme_gumbel, 5},
+    {"_extraDistr_cpp_pgumbel_interval", (DL_FUNC) &_extraDistr_cpp_pgumbel_interval, 5},
+    {"_extraDistr_cpp_hazard_gumbel", (DL_FUNC) &_extraDistr_cpp_hazard_gumbel, 5},
     {"_extraDistr_cpp_dhcauchy", (DL_FUNC) &_extraDistr_cpp_dhcauchy, 3},
     {"_extraDistr_cpp_phcauchy", (DL_FUNC) &_extraDistr_cpp_phcauchy, 4},
     {"_extraDistr_cpp_qhcauchy", (DL_FUNC) &_extraDistr_cpp_qhcauchy, 4},
@@ -7382,13 +9790,20 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_dhuber", (DL_FUNC) &_extraDistr_cpp_dhuber, 5},
     {"_extraDistr_cpp_phuber", (DL_FUNC) &_extraDistr_cpp_phuber, 6},
     {"_extraDistr_cpp_qhuber", (DL_FUNC) &_extraDistr_cpp_qhuber, 6},
-    {"_extraDistr_cpp_rhuber", (DL_FUNC) &_extraDistr_cpp_rhuber, 4},
+    {"_extraDistr_cpp_rhuber", (DL_FUNC) &_extraDistr_cpp_rhuber, 5},
+    {"_extraDistr_cpp_rextreme_huber", (DL_FUNC) &_extraDistr_cpp_rextreme_huber, 6},
+    {"_extraDistr_cpp_huber_rho", (DL_FUNC) &_extraDistr_cpp_huber_rho, 2},
+    {"_extraDistr_cpp_huber_psi", (DL_FUNC) &_extraDistr_cpp_huber_psi, 2},
+    {"_extraDistr_cpp_huber_weight", (DL_FUNC) &_extraDistr_cpp_huber_weight, 2},
+    {"_extraDistr_cpp_huber_scale", (DL_FUNC) &_extraDistr_cpp_huber_scale, 5},
+    {"_extraDistr_cpp_huber_irls", (DL_FUNC) &_extraDistr_cpp_huber_irls, 6},
     {"_extraDistr_cpp_dinvgamma", (DL_FUNC) &_extraDistr_cpp_dinvgamma, 4},
     {"_extraDistr_cpp_pinvgamma", (DL_FUNC) &_extraDistr_cpp_pinvgamma, 5},
     {"_extraDistr_cpp_dkumar", (DL_FUNC) &_extraDistr_cpp_dkumar, 4},
     {"_extraDistr_cpp_pkumar", (DL_FUNC) &_extraDistr_cpp_pkumar, 5},
     {"_extraDistr_cpp_qkumar", (DL_FUNC) &_extraDistr_cpp_qkumar, 5},
-    {"_extraDistr_cpp_rkumar", (DL_FUNC) &_extraDistr_cpp_rkumar, 3},
+    {"_extraDistr_cpp_rkumar", (DL_FUNC) &_extraDistr_cpp_rkumar, 4},
+    {"_extraDistr_cpp_rextreme_kumar", (DL_FUNC) &_extraDistr_cpp_rextreme_kumar, 5},
     {"_extraDistr_cpp_dlaplace", (DL_FUNC) &_extraDistr_cpp_dlaplace, 4},
     {"_extraDistr_cpp_plaplace", (DL_FUNC) &_extraDistr_cpp_plaplace, 5},
     {"_extraDistr_cpp_qlaplace", (DL_FUNC) &_extraDistr_cpp_qlaplace, 5},
@@ -7404,7 +9819,11 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_dlomax", (DL_FUNC) &_extraDistr_cpp_dlomax, 4},
     {"_extraDistr_cpp_plomax", (DL_FUNC) &_extraDistr_cpp_plomax, 5},
     {"_extraDistr_cpp_qlomax", (DL_FUNC) &_extraDistr_cpp_qlomax, 5},
-    {"_extraDistr_cpp_rlomax", (DL_FUNC) &_extraDistr_cpp_rlomax, 3},
+    {"_extraDistr_cpp_rlomax", (DL_FUNC) &_extraDistr_cpp_rlomax, 4},
+    {"_extraDistr_cpp_rextreme_lomax", (DL_FUNC) &_extraDistr_cpp_rextreme_lomax, 5},
+    {"_extraDistr_cpp_plomax_interval", (DL_FUNC) &_extraDistr_cpp_plomax_interval, 5},
+    {"_extraDistr_cpp_dcens_lomax", (DL_FUNC) &_extraDistr_cpp_dcens_lomax, 5},
+    {"_extraDistr_cpp_hazard_lomax", (DL_FUNC) &_extraDistr_cpp_hazard_lomax, 5},
     {"_extraDistr_cpp_dmixnorm", (DL_FUNC) &_extraDistr_cpp_dmixnorm, 5},
     {"_extraDistr_cpp_pmixnorm", (DL_FUNC) &_extraDistr_cpp_pmixnorm, 6},
     {"_extraDistr_cpp_rmixnorm", (DL_FUNC) &_extraDistr_cpp_rmixnorm, 4},
@@ -7415,6 +9834,8 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_rmnom", (DL_FUNC) &_extraDistr_cpp_rmnom, 3},
     {"_extraDistr_cpp_dmvhyper", (DL_FUNC) &_extraDistr_cpp_dmvhyper, 4},
     {"_extraDistr_cpp_rmvhyper", (DL_FUNC) &_extraDistr_cpp_rmvhyper, 3},
+    {"_extraDistr_cpp_dmvnorm", (DL_FUNC) &_extraDistr_cpp_dmvnorm, 4},
+    {"_extraDistr_cpp_rmvnorm", (DL_FUNC) &_extraDistr_cpp_rmvnorm, 3},
     {"_extraDistr_cpp_dnhyper", (DL_FUNC) &_extraDistr_cpp_dnhyper, 5},
     {"_extraDistr_cpp_pnhyper", (DL_FUNC) &_extraDistr_cpp_pnhyper, 6},
     {"_extraDistr_cpp_qnhyper", (DL_FUNC) &_extraDistr_cpp_qnhyper, 6},
@@ -7426,27 +9847,39 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_dpareto", (DL_FUNC) &_extraDistr_cpp_dpareto, 4},
     {"_extraDistr_cpp_ppareto", (DL_FUNC) &_extraDistr_cpp_ppareto, 5},
     {"_extraDistr_cpp_qpareto", (DL_FUNC) &_extraDistr_cpp_qpareto, 5},
-    {"_extraDistr_cpp_rpareto", (DL_FUNC) &_extraDistr_cpp_rpareto, 3},
+    {"_extraDistr_cpp_rpareto", (DL_FUNC) &_extraDistr_cpp_rpareto, 4},
+    {"_extraDistr_cpp_rextreme_pareto", (DL_FUNC) &_extraDistr_cpp_rextreme_pareto, 5},
+    {"_extraDistr_cpp_dcens_pareto", (DL_FUNC) &_extraDistr_cpp_dcens_pareto, 5},
+    {"_extraDistr_cpp_hazard_pareto", (DL_FUNC) &_extraDistr_cpp_hazard_pareto, 5},
     {"_extraDistr_cpp_dpower", (DL_FUNC) &_extraDistr_cpp_dpower, 4},
     {"_extraDistr_cpp_ppower", (DL_FUNC) &_extraDistr_cpp_ppower, 5},
     {"_extraDistr_cpp_qpower", (DL_FUNC) &_extraDistr_cpp_qpower, 5},
-    {"_extraDistr_cpp_rpower", (DL_FUNC) &_extraDistr_cpp_rpower, 3},
+    {"_extraDistr_cpp_rpower", (DL_FUNC) &_extraDistr_cpp_rpower, 4},
+    {"_extraDistr_cpp_rextreme_power", (DL_FUNC) &_extraDistr_cpp_rextreme_power, 5},
     {"_extraDistr_cpp_dprop", (DL_FUNC) &_extraDistr_cpp_dprop, 5},
     {"_extraDistr_cpp_pprop", (DL_FUNC) &_extraDistr_cpp_pprop, 6},
     {"_extraDistr_cpp_qprop", (DL_FUNC) &_extraDistr_cpp_qprop, 6},
     {"_extraDistr_cpp_rprop", (DL_FUNC) &_extraDistr_cpp_rprop, 4},
+    {"_extraDistr_cpp_qapprox_cheb", (DL_FUNC) &_extraDistr_cpp_qapprox_cheb, 6},
+    {"_extraDistr_cpp_qapprox_disc", (DL_FUNC) &_extraDistr_cpp_qapprox_disc, 8},
     {"_extraDistr_cpp_rsign", (DL_FUNC) &_extraDistr_cpp_rsign, 1},
     {"_extraDistr_cpp_drayleigh", (DL_FUNC) &_extraDistr_cpp_drayleigh, 3},
     {"_extraDistr_cpp_prayleigh", (DL_FUNC) &_extraDistr_cpp_prayleigh, 4},
     {"_extraDistr_cpp_qrayleigh", (DL_FUNC) &_extraDistr_cpp_qrayleigh, 4},
-    {"_extraDistr_cpp_rrayleigh", (DL_FUNC) &_extraDistr_cpp_rrayleigh, 2},
+    {"_extraDistr_cpp_rrayleigh", (DL_FUNC) &_extraDistr_cpp_rrayleigh, 3},
+    {"_extraDistr_cpp_rextreme_rayleigh", (DL_FUNC) &_extraDistr_cpp_rextreme_rayleigh, 4},
+    {"_extraDistr_cpp_dcens_rayleigh", (DL_FUNC) &_extraDistr_cpp_dcens_rayleigh, 4},
     {"_extraDistr_cpp_dsgomp", (DL_FUNC) &_extraDistr_cpp_dsgomp, 4},
     {"_extraDistr_cpp_psgomp", (DL_FUNC) &_extraDistr_cpp_psgomp, 5},
+    {"_extraDistr_cpp_qsgomp", (DL_FUNC) &_extraDistr_cpp_qsgomp, 5},
     {"_extraDistr_cpp_rsgomp", (DL_FUNC) &_extraDistr_cpp_rsgomp, 3},
+    {"_extraDistr_cpp_dcens_sgomp", (DL_FUNC) &_extraDistr_cpp_dcens_sgomp, 5},
+    {"_extraDistr_cpp_hazard_sgomp", (DL_FUNC) &_extraDistr_cpp_hazard_sgomp, 5},
     {"_extraDistr_cpp_dskellam", (DL_FUNC) &_extraDistr_cpp_dskellam, 4},
     {"_extraDistr_cpp_rskellam", (DL_FUNC) &_extraDistr_cpp_rskellam, 3},
     {"_extraDistr_cpp_dslash", (DL_FUNC) &_extraDistr_cpp_dslash, 4},
     {"_extraDistr_cpp_pslash", (DL_FUNC) &_extraDistr_cpp_pslash, 5},
+    {"_extraDistr_cpp_qslash", (DL_FUNC) &_extraDistr_cpp_qslash, 5},
     {"_extraDistr_cpp_rslash", (DL_FUNC) &_extraDistr_cpp_rslash, 3},
     {"_extraDistr_cpp_dtriang", (DL_FUNC) &_extraDistr_cpp_dtriang, 5},
     {"_extraDistr_cpp_ptriang", (DL_FUNC) &_extraDistr_cpp_ptriang, 6},
@@ -7465,10 +9898,13 @@ static const R_CallMethodDef CallEntries[] = {
     {"_extraDistr_cpp_qtpois", (DL_FUNC) &_extraDistr_cpp_qtpois, 6},
     {"_extraDistr_cpp_rtpois", (DL_FUNC) &_extraDistr_cpp_rtpois, 4},
     {"_extraDistr_cpp_qtlambda", (DL_FUNC) &_extraDistr_cpp_qtlambda, 4},
-    {"_extraDistr_cpp_rtlambda", (DL_FUNC) &_extraDistr_cpp_rtlambda, 2},
+    {"_extraDistr_cpp_rtlambda", (DL_FUNC) &_extraDistr_cpp_rtlambda, 3},
+    {"_extraDistr_cpp_rextreme_tlambda", (DL_FUNC) &_extraDistr_cpp_rextreme_tlambda, 4},
     {"_extraDistr_cpp_dwald", (DL_FUNC) &_extraDistr_cpp_dwald, 4},
     {"_extraDistr_cpp_pwald", (DL_FUNC) &_extraDistr_cpp_pwald, 5},
+    {"_extraDistr_cpp_qwald", (DL_FUNC) &_extraDistr_cpp_qwald, 5},
     {"_extraDistr_cpp_rwald", (DL_FUNC) &_extraDistr_cpp_rwald, 3},
+    {"_extraDistr_cpp_dcens_wald", (DL_FUNC) &_extraDistr_cpp_dcens_wald, 5},
     {"_extraDistr_cpp_dzib", (DL_FUNC) &_extraDistr_cpp_dzib, 5},
     {"_extraDistr_cpp_pzib", (DL_FUNC) &_extraDistr_cpp_pzib, 6},
     {"_extraDistr_cpp_qzib", (DL_FUNC) &_extraDistr_cpp_qzib, 6},
@@ -39,10 +39,7 @@ inline double pdf_bernoulli(double x, double prob,
   if (x == 0.0)
     return 1.0 - prob;
   
-  char msg[55];
-  std::snprintf(msg, sizeof(msg), "improper x = %f", x);
-  Rcpp::warning(msg);
-  
+  note_improper(x);
   return 0.0;
 }
 
@@ -105,13 +102,17 @@ NumericVector cpp_dbern(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = pdf_bernoulli(GETV(x, i), GETV(prob, i),
                          throw_warning);
+  }
   
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
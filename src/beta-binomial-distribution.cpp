@@ -48,8 +48,8 @@ inline double logpmf_bbinom(double k, double n, double alpha,
 inline std::vector<double> cdf_bbinom_table(double k, double n,
                                             double alpha, double beta) {
   
-  if (k < 0.0 || k > n || alpha < 0.0 || beta < 0.0)
-    Rcpp::stop("inadmissible values");
+  // the caller needs to assure that the parameters are admissible
+  // and the size of the table is within the integer range
 
   int ik = to_pos_int(k);
   std::vector<double> p_tab(ik+1);
@@ -83,8 +83,6 @@ inline std::vector<double> cdf_bbinom_table(double k, double n,
   double dj;
   
   for (int j = 2; j <= ik; j++) {
-    if (j % 10000 == 0)
-      Rcpp::checkUserInterrupt();
     dj = to_dbl(j);
     nck += log((n + 1.0 - dj)/dj);
     gx += log(dj + alpha - 1.0);
@@ -95,6 +93,115 @@ inline std::vector<double> cdf_bbinom_table(double k, double n,
   return p_tab;
 }
 
+// for alpha >= 1 and beta >= 1 the pmf is log-concave, the ratio of
+// the consecutive probabilities is (n-k)(k+alpha) / ((k+1)(n-k-1+beta));
+// false if the table would be larger than max_size
+
+inline bool bbinom_mode_table(double n, double alpha, double beta,
+                              double max_size, pmf_table& tab) {
+  return make_mode_table([=](double k) {
+    return (n-k) * (k+alpha) / ((k+1.0) * (n-k-1.0+beta));
+  }, 0.0, n, max_size, tab);
+}
+
+/*
+ * Approximation of the cdf for large n
+ * 
+ * Since P(Binomial(n, t) <= x) = P(B > t) for B ~ Beta(x+1, n-x), the cdf
+ * is P(X <= x) = P(p < B) = E[F(B)], where F is the cdf of p ~ Beta(alpha, beta).
+ * B is concentrated around its mean mu, with variance s2 = O(1/n), so
+ * E[F(B)] is approximated by the Laplace (delta method) expansion
+ * 
+ *   F(mu) + F''(mu) s2/2 + F'''(mu) m3/6
+ * 
+ * where m3 is the third central moment of B. The size of the next term,
+ * F''''(mu) s2^2/8, serves as the error estimate. If it exceeds tol (close
+ * to the bounds of the support, or when p is concentrated as well), E[F(B)]
+ * is computed by Gauss-Legendre quadrature over mu +/- 40 sd, doubling the
+ * number of panels until two consecutive results differ by less than tol.
+ * 
+ */
+
+static const double GL8_NODES[4] = {
+  0.1834346424956498, 0.5255324099163290,
+  0.7966664774136267, 0.9602898564975363
+};
+static const double GL8_WEIGHTS[4] = {
+  0.3626837833783620, 0.3137066458778873,
+  0.2223810344533745, 0.1012285362903763
+};
+static const int BBINOM_QUAD_MAXPANELS = 4096;
+
+inline double bbinom_quad(double a, double b, double alpha, double beta,
+                          double lo, double hi, int panels) {
+  double h = (hi - lo) / to_dbl(panels);
+  double total = 0.0;
+  double c, s;
+  for (int j = 0; j < panels; j++) {
+    c = lo + (to_dbl(j) + 0.5) * h;
+    for (int k = 0; k < 4; k++) {
+      s = c - GL8_NODES[k] * h / 2.0;
+      total += GL8_WEIGHTS[k] * R::pbeta(s, alpha, beta, true, false) *
+        R::dbeta(s, a, b, false);
+      s = c + GL8_NODES[k] * h / 2.0;
+      total += GL8_WEIGHTS[k] * R::pbeta(s, alpha, beta, true, false) *
+        R::dbeta(s, a, b, false);
+    }
+  }
+  return total * h / 2.0;
+}
+
+double cdf_bbinom_approx(double x, double n, double alpha,
+                         double beta, double tol) {
+  
+  // the caller needs to assure that the parameters are admissible
+  // and 0 <= x < n
+  
+  double a, b, ab, mu, sd, s2, m3, f, g, g1, g2, F2, F3, F4, res;
+  
+  a = floor(x) + 1.0;
+  b = n - floor(x);
+  ab = a + b;
+  mu = a / ab;
+  s2 = a * b / (ab * ab * (ab + 1.0));
+  sd = sqrt(s2);
+  m3 = 2.0 * (b - a) * a * b / (ab * ab * ab * (ab + 1.0) * (ab + 2.0));
+  
+  // derivatives of F, g is the derivative of the log-density of p
+  f = R::dbeta(mu, alpha, beta, false);
+  g = (alpha - 1.0)/mu - (beta - 1.0)/(1.0 - mu);
+  g1 = -(alpha - 1.0)/(mu*mu) - (beta - 1.0)/((1.0 - mu)*(1.0 - mu));
+  g2 = 2.0*(alpha - 1.0)/(mu*mu*mu) - 2.0*(beta - 1.0)/pow(1.0 - mu, 3.0);
+  F2 = f * g;
+  F3 = f * (g*g + g1);
+  F4 = f * (g*g*g + 3.0*g*g1 + g2);
+  
+  if (R_FINITE(F4) && abs(F4) * s2 * s2 / 8.0 <= tol &&
+      mu - 10.0 * sd > 0.0 && mu + 10.0 * sd < 1.0) {
+    res = R::pbeta(mu, alpha, beta, true, false) + F2 * s2 / 2.0 + F3 * m3 / 6.0;
+    return trunc_p(res);
+  }
+  
+  double lo = std::max(0.0, mu - 40.0 * sd);
+  double hi = std::min(1.0, mu + 40.0 * sd);
+  int panels = 16;
+  double prev = bbinom_quad(a, b, alpha, beta, lo, hi, panels);
+  
+  for (;;) {
+    panels *= 2;
+    res = bbinom_quad(a, b, alpha, beta, lo, hi, panels);
+    if (abs(res - prev) <= tol)
+      break;
+    if (panels >= BBINOM_QUAD_MAXPANELS) {
+      note_no_convergence(x);
+      break;
+    }
+    prev = res;
+  }
+  
+  return trunc_p(res);
+}
+
 inline double rng_bbinom(double n, double alpha,
                          double beta, bool& throw_warning) {
   if (ISNAN(n) || ISNAN(alpha) || ISNAN(beta) ||
@@ -131,14 +238,25 @@ NumericVector cpp_dbbinom(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_bbinom(GETV(x, i), GETV(size, i),
-                         GETV(alpha, i), GETV(beta, i),
-                         throw_warning);
+  value_cache<4> cache(Nmax);
+  double xi, ni, ai, bi;
+
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
+    xi = GETV(x, i);
+    ni = GETV(size, i);
+    ai = GETV(alpha, i);
+    bi = GETV(beta, i);
+    p[i] = cached_eval(cache, {{xi, ni, ai, bi}}, isInteger(xi, false), [&]() {
+      return logpmf_bbinom(xi, ni, ai, bi, throw_warning);
+    });
+  }
 
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
 
@@ -172,18 +290,23 @@ NumericVector cpp_pbbinom(
   bool throw_warning = false;
   
   std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, pmf_table> mode_memo;
+  std::map<std::tuple<int, int, int>, pmf_table>::iterator it;
+  double tol = approx_tolerance();
 
   // maximum modulo size.length(), bounded in [0, size]
   int n = x.length();
   int k = size.length();
   NumericVector mx(k, 0.0);
   for (int i = 0; i < std::max(n, k); i++) {
-    if (mx[i % k] < GETV(x, i)) {
+    if (mx[i % k] < GETV(x, i) && !is_large_int(GETV(x, i))) {
       mx[i % k] = std::min(GETV(x, i), GETV(size, i));
     }
   }
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
@@ -206,17 +329,45 @@ NumericVector cpp_pbbinom(
       p[i] = 1.0;
     } else if (is_large_int(GETV(x, i))) {
       p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      note_int_coercion();
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      std::tuple<int, int, int> key = std::make_tuple(
         static_cast<int>(i % size.length()),
         static_cast<int>(i % alpha.length()),
         static_cast<int>(i % beta.length())
-      )];
+      );
+      
+      // mode-centred table, unless the table up to max(x) is smaller;
+      // if the tables would exceed TABLE_MAX_SIZE the cdf is approximated
+      double max_size = mx[i % size.length()] + 1.0;
+      if (tol > 0.0)
+        max_size = std::min(max_size, to_dbl(TABLE_MAX_SIZE));
+      
+      if (GETV(alpha, i) >= 1.0 && GETV(beta, i) >= 1.0) {
+        it = mode_memo.find(key);
+        if (it == mode_memo.end()) {
+          pmf_table tab;
+          bbinom_mode_table(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                            max_size, tab);
+          it = mode_memo.insert(std::make_pair(key, tab)).first;
+        }
+        if (it->second.pmf.size()) {
+          p[i] = table_cdf(it->second, GETV(x, i));
+          continue;
+        }
+      }
+      
+      if (mx[i % size.length()] + 1.0 > max_size) {
+        p[i] = cdf_bbinom_approx(GETV(x, i), GETV(size, i),
+                                 GETV(alpha, i), GETV(beta, i), tol);
+        note_approximation();
+        continue;
+      }
+      
+      std::vector<double>& tmp = memo[key];
       
       if (!tmp.size()) {
-        double mxi = std::min(mx[i % size.length()], GETV(size, i));
         tmp = cdf_bbinom_table(mx[i % size.length()], GETV(size, i), GETV(alpha, i), GETV(beta, i));
       }
       p[i] = tmp[to_pos_int(GETV(x, i))];
@@ -230,6 +381,7 @@ NumericVector cpp_pbbinom(
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
 
@@ -253,10 +405,57 @@ NumericVector cpp_rbbinom(
   NumericVector x(n);
   
   bool throw_warning = false;
-
-  for (int i = 0; i < n; i++)
-    x[i] = rng_bbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
-                      throw_warning);
+  
+  // number of draws per parameter set
+  int Nmax = std::max({size.length(), alpha.length(), beta.length()});
+  int draws = n / Nmax;
+  
+  if (draws < 2) {
+    
+    for (int i = 0; i < n; i++)
+      x[i] = rng_bbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                        throw_warning);
+    
+  } else {
+    
+    // parameter sets with size small relatively to the number of draws are
+    // sampled by inversion of the cumulative probabilities table, the total
+    // size of the tables is bounded by TABLE_DRAWS * n;
+    // the tables are keyed by the parameter values, so that repeated
+    // parameter sets share a table also at different positions
+    
+    std::map<std::tuple<double, double, double>, cdf_table> memo;
+    
+    for (int i = 0; i < n; i++) {
+      
+      if (ISNAN(GETV(size, i)) || ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i)) ||
+          GETV(alpha, i) < 0.0 || GETV(beta, i) < 0.0 || GETV(size, i) < 0.0 ||
+          !isInteger(GETV(size, i), false)) {
+        throw_warning = true;
+        x[i] = NA_REAL;
+        continue;
+      }
+      
+      if (GETV(size, i) + 1.0 > to_dbl(TABLE_DRAWS * draws) ||
+          GETV(alpha, i) == 0.0 || GETV(beta, i) == 0.0) {
+        x[i] = rng_bbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                          throw_warning);
+        continue;
+      }
+      
+      cdf_table& tab = memo[std::make_tuple(
+        GETV(size, i), GETV(alpha, i), GETV(beta, i)
+      )];
+      
+      if (!tab.cdf.size()) {
+        tab.cdf = cdf_bbinom_table(GETV(size, i), GETV(size, i),
+                                   GETV(alpha, i), GETV(beta, i));
+        make_guide_table(tab);
+      }
+      x[i] = to_dbl(rng_table(rng_unif(), tab));
+      
+    }
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -50,8 +50,8 @@ inline double logpmf_bnbinom(double k, double r, double alpha,
 inline std::vector<double> cdf_bnbinom_table(double k, double r,
                                              double alpha, double beta) {
   
-  if (k < 0.0 || !R_FINITE(k) || r < 0.0 || alpha < 0.0 || beta < 0.0)
-    Rcpp::stop("inadmissible values");
+  // the caller needs to assure that the parameters are admissible
+  // and the size of the table is within the integer range
 
   int ik = to_pos_int(k);
   std::vector<double> p_tab(ik+1);
@@ -87,8 +87,6 @@ inline std::vector<double> cdf_bnbinom_table(double k, double r,
   double dj;
   
   for (int j = 2; j <= ik; j++) {
-    if (j % 10000 == 0)
-      Rcpp::checkUserInterrupt();
     dj = to_dbl(j);
     grx += log(r + dj - 1.0);
     gbx += log(beta + dj - 1.0);
@@ -101,6 +99,56 @@ inline std::vector<double> cdf_bnbinom_table(double k, double r,
   return p_tab;
 }
 
+// cumulative probabilities P(X <= j), for j = 0, 1, ..., until they reach
+// 1 - BNBINOM_TAIL, or the table has max_size elements; the pmf is computed
+// by the recurrence f(j)/f(j-1) = (r+j-1)(beta+j-1) / (j (alpha+beta+r+j-1))
+
+static const double BNBINOM_TAIL = 1e-12;
+
+inline std::vector<double> cdf_bnbinom_table_tail(double r, double alpha,
+                                                  double beta, int max_size) {
+  
+  // the caller needs to assure that the parameters are admissible
+  
+  std::vector<double> p_tab;
+  double dj, f, F;
+  
+  f = exp(R::lbeta(alpha + r, beta) - R::lbeta(alpha, beta));
+  F = f;
+  p_tab.push_back(F);
+  
+  for (int j = 1; j < max_size && F < 1.0 - BNBINOM_TAIL; j++) {
+    dj = to_dbl(j);
+    f *= (r + dj - 1.0) * (beta + dj - 1.0) / (dj * (alpha + beta + r + dj - 1.0));
+    F += f;
+    p_tab.push_back(F);
+  }
+  
+  return p_tab;
+}
+
+// inversion using the table and, for u beyond it, sequential search
+// continuing the recurrence
+
+inline double rng_bnbinom_table(const cdf_table& tab, double r, double alpha,
+                                double beta) {
+  double u = rng_unif();
+  int K = tab.cdf.size();
+  if (u <= tab.cdf[K-1])
+    return to_dbl(rng_table(u, tab));
+  double dj = to_dbl(K - 1);
+  double F = tab.cdf[K-1];
+  double f = F - tab.cdf[K-2];
+  while (F < u) {
+    dj += 1.0;
+    f *= (r + dj - 1.0) * (beta + dj - 1.0) / (dj * (alpha + beta + r + dj - 1.0));
+    if (F + f == F)
+      break;
+    F += f;
+  }
+  return dj;
+}
+
 inline double rng_bnbinom(double r, double alpha,
                           double beta, bool& throw_warning) {
   if (ISNAN(r) || ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 ||
@@ -137,13 +185,17 @@ NumericVector cpp_dbnbinom(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = logpmf_bnbinom(GETV(x, i), GETV(size, i), GETV(alpha, i),
                           GETV(beta, i), throw_warning);
+  }
 
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
 
@@ -184,12 +236,14 @@ NumericVector cpp_pbnbinom(
   NumericVector mx(k, 0.0);
   for (int i = 0; i < std::max(n, k); i++) {
     double xi = GETV(x, i);
-    if (mx[i % k] < xi && R_FINITE(xi)) {
+    if (mx[i % k] < xi && R_FINITE(xi) && !is_large_int(xi)) {
       mx[i % k] = xi;
     }
   }
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
@@ -211,7 +265,7 @@ NumericVector cpp_pbnbinom(
       p[i] = 1.0;
     } else if (is_large_int(GETV(x, i))) {
       p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      note_int_coercion();
     } else {
       
       std::vector<double>& tmp = memo[std::make_tuple(
@@ -235,6 +289,7 @@ NumericVector cpp_pbnbinom(
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
 
@@ -258,10 +313,61 @@ NumericVector cpp_rbnbinom(
   NumericVector x(n);
   
   bool throw_warning = false;
-
-  for (int i = 0; i < n; i++)
-    x[i] = rng_bnbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
-                       throw_warning);
+  
+  // number of draws per parameter set
+  int Nmax = std::max({size.length(), alpha.length(), beta.length()});
+  int draws = n / Nmax;
+  
+  if (draws < 2) {
+    
+    for (int i = 0; i < n; i++)
+      x[i] = rng_bnbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                         throw_warning);
+    
+  } else {
+    
+    // parameter sets for which the table of size at most TABLE_DRAWS * draws
+    // covers all but BNBINOM_TAIL of the probability are sampled by inversion,
+    // the remaining ones (heavy tails) by compounding;
+    // the tables are keyed by the parameter values, so that repeated
+    // parameter sets share a table also at different positions
+    
+    std::map<std::tuple<double, double, double>, cdf_table> memo;
+    std::map<std::tuple<double, double, double>, cdf_table>::iterator it;
+    std::tuple<double, double, double> key;
+    
+    for (int i = 0; i < n; i++) {
+      
+      if (ISNAN(GETV(size, i)) || ISNAN(GETV(alpha, i)) || ISNAN(GETV(beta, i)) ||
+          GETV(alpha, i) <= 0.0 || GETV(beta, i) <= 0.0 || GETV(size, i) <= 0.0) {
+        x[i] = rng_bnbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                           throw_warning);
+        continue;
+      }
+      
+      key = std::make_tuple(GETV(size, i), GETV(alpha, i), GETV(beta, i));
+      it = memo.find(key);
+      
+      if (it == memo.end()) {
+        cdf_table tab;
+        tab.cdf = cdf_bnbinom_table_tail(GETV(size, i), GETV(alpha, i),
+                                         GETV(beta, i), TABLE_DRAWS * draws);
+        if (tab.cdf.size() > 1 && tab.cdf.back() >= 1.0 - BNBINOM_TAIL)
+          make_guide_table(tab);
+        else
+          tab.cdf.clear();
+        it = memo.insert(std::make_pair(key, tab)).first;
+      }
+      
+      if (it->second.cdf.size())
+        x[i] = rng_bnbinom_table(it->second, GETV(size, i),
+                                 GETV(alpha, i), GETV(beta, i));
+      else
+        x[i] = rng_bnbinom(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                           throw_warning);
+      
+    }
+  }
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
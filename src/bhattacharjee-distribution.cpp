@@ -31,8 +31,32 @@ inline double G(double x) {
   return x * Phi(x) + phi(x);
 }
 
-inline double pdf_bhattacharjee(double x, double mu, double sigma,
-                                double a, bool& throw_warning) {
+/*
+ * log G(x), for x < -5 G(x) = phi(x) * c/(|x| + c), where
+ * c = 1/(|x| + 2/(|x| + 3/(|x| + ...))) is the continued fraction
+ * for the Mills ratio with the leading term dropped, what avoids
+ * the cancellation in x*Phi(x) + phi(x).
+ */
+
+inline double log_G(double x) {
+  if (x >= -5.0)
+    return log(G(x));
+  double t = -x;
+  double v = t;
+  for (int k = 40; k >= 2; k--)
+    v = t + k/v;
+  double c = 1.0/v;
+  return lphi(t) + log(c/(t + c));
+}
+
+/*
+ * The density is symmetric around mu, so it is computed for |x-mu|
+ * as a difference of the upper tail probabilities in log-space,
+ * what does not lose precision in the tails.
+ */
+
+inline double logpdf_bhattacharjee(double x, double mu, double sigma,
+                                   double a, bool& throw_warning) {
 #ifdef IEEE_754
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a))
     return x+mu+sigma+a;
@@ -42,11 +66,13 @@ inline double pdf_bhattacharjee(double x, double mu, double sigma,
     return NAN;
   }
   if (sigma == 0.0)
-    return R::dunif(x, mu-a, mu+a, false);
+    return R::dunif(x, mu-a, mu+a, true);
   if (a == 0.0)
-    return R::dnorm(x, mu, sigma, false);
-  double z = x-mu;
-  return (Phi((z+a)/sigma) - Phi((z-a)/sigma)) / (2.0*a);
+    return R::dnorm(x, mu, sigma, true);
+  double z = abs(x-mu);
+  double log_q_lo = R::pnorm((z-a)/sigma, 0.0, 1.0, false, true);
+  double log_q_hi = R::pnorm((z+a)/sigma, 0.0, 1.0, false, true);
+  return logdiffexp(log_q_lo, log_q_hi) - log(2.0*a);
 }
 
 inline double cdf_bhattacharjee(double x, double mu, double sigma,
@@ -68,7 +94,57 @@ inline double cdf_bhattacharjee(double x, double mu, double sigma,
   if (a == 0.0)
     return R::pnorm(x, mu, sigma, true, false);
   double z = x-mu;
-  return sigma/(2.0*a) * (G((z+a)/sigma) - G((z-a)/sigma));
+  // sigma/(2*a) * (G((z+a)/sigma) - G((z-a)/sigma))
+  return exp(log(sigma/(2.0*a)) +
+             logdiffexp(log_G((z+a)/sigma), log_G((z-a)/sigma)));
+}
+
+/*
+ * The distribution is symmetric, so P(X - mu > z) = min(p, 1-p) is solved
+ * for z >= 0 by Newton iterations (see invcdf_newton), starting from
+ * the sum of the upper quantiles of the uniform (-a, a) and of the
+ * normal (0, sigma) components, a*(1-2*p) + sigma*Phi^-1(1-p).
+ */
+
+inline double invcdf_bhattacharjee(double p, double mu, double sigma,
+                                   double a, bool lower_tail, bool log_prob,
+                                   bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(a))
+    return p+mu+sigma+a;
+#endif
+  double log_pl, log_pu;
+  if (sigma < 0.0 || a < 0.0 ||
+      !log_tail_probs(p, lower_tail, log_prob, log_pl, log_pu)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (sigma == 0.0)
+    return R::qunif(log_pl, mu-a, mu+a, true, true);
+  if (a == 0.0)
+    return R::qnorm(log_pl, mu, sigma, true, true);
+  if (log_pl == R_NegInf)
+    return R_NegInf;
+  if (log_pu == R_NegInf)
+    return R_PosInf;
+  if (log_pl == log_pu)
+    return mu;
+  
+  double log_pt = std::min(log_pl, log_pu);
+  double z0 = a*(1.0 - 2.0*exp(log_pt)) +
+              sigma*R::qnorm(log_pt, 0.0, 1.0, false, true);
+  double log_c = log(sigma/(2.0*a));
+  
+  // P(X - mu > z) = P(X - mu <= -z)
+  auto eval = [&](double z, double& log_P, double& log_d, double& h) {
+    bool tw = false;
+    log_P = log_c + logdiffexp(log_G((a-z)/sigma), log_G((-a-z)/sigma));
+    log_d = logpdf_bhattacharjee(z, 0.0, sigma, a, tw);
+    h = NAN;
+  };
+  
+  double z = invcdf_newton(eval, log_pt, true, z0, 0.0, R_PosInf);
+  return (log_pl < log_pu) ? mu - z : mu + z;
 }
 
 inline double rng_bhattacharjee(double mu, double sigma,
@@ -110,12 +186,12 @@ NumericVector cpp_dbhatt(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_bhattacharjee(GETV(x, i), GETV(mu, i),
-                             GETV(sigma, i), GETV(a, i),
-                             throw_warning);
+    p[i] = logpdf_bhattacharjee(GETV(x, i), GETV(mu, i),
+                                GETV(sigma, i), GETV(a, i),
+                                throw_warning);
   
-  if (log_prob)
-    p = Rcpp::log(p);
+  if (!log_prob)
+    p = Rcpp::exp(p);
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -167,6 +243,43 @@ NumericVector cpp_pbhatt(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qbhatt(
+    const NumericVector& p,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& a,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), mu.length(),
+                sigma.length(), a.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    mu.length(),
+    sigma.length(),
+    a.length()
+  });
+  NumericVector q(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    q[i] = invcdf_bhattacharjee(GETV(p, i), GETV(mu, i),
+                                GETV(sigma, i), GETV(a, i),
+                                lower_tail, log_prob, throw_warning);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return q;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rbhatt(
     const int& n,
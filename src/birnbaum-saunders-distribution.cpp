@@ -66,6 +66,53 @@ inline double cdf_fatigue(double x, double alpha, double beta,
   return Phi((zb-bz)/alpha);
 }
 
+inline double logcens_fatigue(double x, double status, double alpha,
+                              double beta, double mu, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
+    return x+status+alpha+beta+mu;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // F(x) = Phi(w), both tails are computed by pnorm directly
+  double w = R_NegInf;
+  if (x > mu)
+    w = (sqrt((x-mu)/beta) - sqrt(beta/(x-mu))) / alpha;
+  return censored_loglik(status, [&]() {
+    return logpdf_fatigue(x, alpha, beta, mu, throw_warning);
+  }, [&]() {
+    return R::pnorm(w, 0.0, 1.0, false, true);
+  }, [&]() {
+    return R::pnorm(w, 0.0, 1.0, true, true);
+  }, throw_warning);
+}
+
+inline double hazard_fatigue(double x, double alpha, double beta, double mu,
+                             bool cumulative, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(alpha) || ISNAN(beta) || ISNAN(mu))
+    return x+alpha+beta+mu;
+#endif
+  if (alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x <= mu)
+    return cumulative ? 0.0 : R_NegInf;
+  // S(x) = Phi(-w), computed by pnorm directly in log-space
+  double z = x-mu;
+  double zb = sqrt(z/beta);
+  double bz = sqrt(beta/z);
+  double log_S = R::pnorm((zb-bz)/alpha, 0.0, 1.0, false, true);
+  if (cumulative)
+    return -log_S;
+  if (x == R_PosInf)
+    return -log(2.0*alpha*alpha*beta);  // limit of h(x)
+  return log(zb+bz) - LOG_2F - log(alpha) - log(z) + lphi((zb-bz)/alpha) - log_S;
+}
+
 inline double invcdf_fatigue(double p, double alpha, double beta,
                              double mu, bool& throw_warning) {
 #ifdef IEEE_754
@@ -246,3 +293,83 @@ NumericVector cpp_rfatigue(
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_fatigue(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const NumericVector& mu,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(),
+                alpha.length(), beta.length(), mu.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    alpha.length(),
+    beta.length(),
+    mu.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_fatigue(GETV(x, i), GETV(status, i), GETV(alpha, i),
+                           GETV(beta, i), GETV(mu, i), throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_fatigue(
+    const NumericVector& x,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const NumericVector& mu,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), alpha.length(), beta.length(), mu.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    alpha.length(),
+    beta.length(),
+    mu.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_fatigue(GETV(x, i), GETV(alpha, i), GETV(beta, i),
+                          GETV(mu, i), cumulative, throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
@@ -97,13 +97,17 @@ NumericVector cpp_dbpois(
   if (x.length() != y.length())
     Rcpp::stop("lengths of x and y differ");
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = logpmf_bpois(GETV(x, i), GETV(y, i), GETV(a, i),
                         GETV(b, i), GETV(c, i), throw_warning);
+  }
   
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
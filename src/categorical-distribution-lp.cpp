@@ -4,6 +4,7 @@
 // [[Rcpp::plugins(cpp11)]]
 
 using std::log;
+using std::exp;
 using Rcpp::NumericVector;
 using Rcpp::NumericMatrix;
 
@@ -22,6 +23,15 @@ using Rcpp::NumericMatrix;
  * 
  * where g[1], ..., g[k] is a sample from standard Gumbel distribution.
  * 
+ * Gumbel-max trick needs k exponential draws per sample, so it is used only
+ * for the rows of log_prob that are used once. For the rows used more times
+ * the probabilities are normalized once, using log-sum-exp, i.e.
+ * 
+ * prob[i] = exp(gamma[i] - max(gamma)) / sum(exp(gamma - max(gamma)))
+ * 
+ * what protects from underflow, and the cumulative probabilities are
+ * tabulated, so each draw needs a single uniform and binary search.
+ * 
  * 
  * References:
  * 
@@ -45,14 +55,72 @@ NumericVector cpp_rcatlp(
   
   NumericVector x(n);
   int k = log_prob.ncol();
+  int nr = log_prob.nrow();
   double u, glp, max_val;
   int jj;
   
   bool throw_warning = false;
   bool wrong_prob = false;
   
+  // rows used at least twice get cumulative probability tables:
+  // tab_row[row] is the offset of the table, -1 for Gumbel-max,
+  // or -2 for rows with missing values
+  
+  std::vector<int> tab_row(nr, -1);
+  std::vector<double> tab;
+  
+  for (int row = 0; row < nr && row < n; row++) {
+    
+    int uses = n / nr + (row < n % nr ? 1 : 0);
+    if (uses < 2)
+      continue;
+    
+    max_val = -INFINITY;
+    for (int j = 0; j < k; j++) {
+      if (ISNAN(log_prob(row, j))) {
+        max_val = NAN;
+        break;
+      }
+      if (log_prob(row, j) > max_val)
+        max_val = log_prob(row, j);
+    }
+    
+    if (ISNAN(max_val)) {
+      tab_row[row] = -2;
+      continue;
+    }
+    if (!R_FINITE(max_val))
+      continue;
+    
+    int offset = tab.size();
+    tab.resize(offset + k);
+    double p_tot = 0.0;
+    for (int j = 0; j < k; j++) {
+      p_tot += exp(log_prob(row, j) - max_val);
+      tab[offset + j] = p_tot;
+    }
+    tab_row[row] = offset;
+    
+  }
+  
   for (int i = 0; i < n; i++) {
     
+    int offset = tab_row[i % nr];
+    
+    if (offset == -2) {
+      throw_warning = true;
+      x[i] = NA_REAL;
+      continue;
+    }
+    
+    if (offset >= 0) {
+      const double* cum = tab.data() + offset;
+      u = rng_unif() * cum[k-1];
+      jj = std::upper_bound(cum, cum + k, u) - cum;
+      x[i] = static_cast<double>(std::min(jj, k-1));
+      continue;
+    }
+    
     max_val = -INFINITY;
     jj = 0;
     
@@ -86,4 +154,3 @@ NumericVector cpp_rcatlp(
   
   return x;
 }
-
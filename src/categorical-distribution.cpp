@@ -71,7 +71,9 @@ NumericVector cpp_dcat(
       prob_tab(i, j) /= p_tot;
   }
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
 #ifdef IEEE_754
     if (ISNAN(GETV(x, i))) {
       p[i] = GETV(x, i);
@@ -84,8 +86,9 @@ NumericVector cpp_dcat(
       continue;
     }
     if (is_large_int(GETV(x, i))) {
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      note_int_coercion();
       p[i] = NA_REAL;
+      continue;
     }
     p[i] = GETM(prob_tab, i, to_pos_int(GETV(x, i)) - 1);
   }
@@ -93,6 +96,7 @@ NumericVector cpp_dcat(
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
     
@@ -147,7 +151,9 @@ NumericVector cpp_pcat(
     }
   }
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
 #ifdef IEEE_754
     if (ISNAN(GETV(x, i))) {
       p[i] = GETV(x, i);
@@ -163,8 +169,9 @@ NumericVector cpp_pcat(
       continue;
     }
     if (is_large_int(GETV(x, i))) {
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      note_int_coercion();
       p[i] = NA_REAL;
+      continue;
     }
     p[i] = GETM(prob_tab, i, to_pos_int(GETV(x, i)) - 1);
   }
@@ -175,6 +182,7 @@ NumericVector cpp_pcat(
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
       
@@ -280,6 +288,89 @@ NumericVector cpp_qcat(
 }
 
 
+/*
+ * Random generation when each row of prob is used at most once (e.g. in
+ * Gibbs samplers), so tabulating the normalized cumulative probabilities
+ * for all the rows does not pay off. The rows are processed in blocks of
+ * consecutive rows: prefix sums are accumulated column by column, what reads
+ * the column-major matrix contiguously and only once, then a single uniform
+ * draw per row is scaled by the unnormalized total and the prefix sums are
+ * searched by bisection.
+ */
+
+static const int RCAT_BLOCK  = 64;     // maximal number of rows in a block
+static const int RCAT_BUFFER = 8192;   // maximal size of the prefix sums buffer
+
+inline void rng_cat_rowwise(NumericVector& x, const NumericMatrix& prob,
+                            bool& throw_warning) {
+  
+  int n = x.length();
+  int nr = prob.nrow();
+  int k = prob.ncol();
+  int B = std::max(1, std::min(RCAT_BLOCK, RCAT_BUFFER / k));
+  
+  const double* pr = &prob[0];
+  std::vector<double> cum(B * k);
+  std::vector<double> min_p(B);
+  double u, total;
+  int b, lo, hi, mid;
+  
+  for (int i0 = 0; i0 < n; i0 += B) {
+    
+    b = std::min(B, n - i0);
+    
+    const double* col = pr + i0;
+    for (int r = 0; r < b; r++) {
+      cum[r] = col[r];
+      min_p[r] = col[r];
+    }
+    for (int j = 1; j < k; j++) {
+      col = pr + i0 + static_cast<std::ptrdiff_t>(j) * nr;
+      double* c = &cum[j * b];
+      const double* c_prev = c - b;
+      for (int r = 0; r < b; r++) {
+        c[r] = c_prev[r] + col[r];
+        min_p[r] = std::min(min_p[r], col[r]);
+      }
+    }
+    
+    for (int r = 0; r < b; r++) {
+      
+      total = cum[(k-1) * b + r];
+      
+      if (ISNAN(total)) {
+        x[i0 + r] = NA_REAL;
+        continue;
+      }
+      if (min_p[r] < 0.0) {
+        throw_warning = true;
+        x[i0 + r] = NAN;
+        continue;
+      }
+      if (total <= 0.0 || !R_FINITE(total)) {
+        x[i0 + r] = NAN;
+        continue;
+      }
+      
+      u = rng_unif() * total;
+      
+      // first j such that cum[j] >= u
+      lo = 0;
+      hi = k - 1;
+      while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (cum[mid * b + r] >= u)
+          hi = mid;
+        else
+          lo = mid + 1;
+      }
+      x[i0 + r] = to_dbl(lo + 1);
+      
+    }
+  }
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rcat(
     const int& n,
@@ -300,6 +391,13 @@ NumericVector cpp_rcat(
   
   if (k < 2)
     Rcpp::stop("number of columns in prob is < 2");
+  
+  if (n <= prob.nrow()) {
+    rng_cat_rowwise(x, prob, throw_warning);
+    if (throw_warning)
+      Rcpp::warning("NAs produced");
+    return x;
+  }
 
   NumericMatrix prob_tab = Rcpp::clone(prob);
   
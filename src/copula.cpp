@@ -0,0 +1,141 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using std::sqrt;
+using std::abs;
+using std::exp;
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+using Rcpp::CharacterVector;
+
+
+/*
+ * Gaussian and t copulas
+ *
+ * z = L e, where L is the Cholesky factor of the correlation matrix and
+ * e are independent standard normal values; for the t copula z is also
+ * scaled by sqrt(df/W), where W ~ chi^2(df). The j-th margin is obtained
+ * as F_j^-1(P(z_j)), where P is the cdf of the standard normal, or of the
+ * t distribution. The quantile functions of the margins take the logs of
+ * both P(z_j) and 1 - P(z_j), each computed in its own tail, so the upper
+ * tails of the margins are not truncated at 1 - DBL_EPSILON.
+ *
+ * The rows are drawn in blocks of RNG_BLOCK and each block is transformed
+ * column by column, so the margins are obtained in the same pass without
+ * any intermediate n x d matrices.
+ *
+ */
+
+// [[Rcpp::export]]
+NumericMatrix cpp_rcopula(
+    const int& n,
+    const NumericMatrix& corr,
+    const CharacterVector& family,
+    const NumericMatrix& theta,
+    const double& df
+  ) {
+
+  int d = corr.nrow();
+  bool uniform = family.length() == 0;
+
+  if (d < 1 || corr.ncol() != d)
+    Rcpp::stop("corr needs to be a square matrix");
+  if (!uniform && (family.length() != d || theta.ncol() != d ||
+                   theta.nrow() != MIX_MAX_PAR))
+    Rcpp::stop("number of margins does not match the dimension of corr");
+
+  NumericMatrix x(n, d);
+  bool missing = ISNAN(df);
+
+  for (int i = 0; i < d; i++) {
+    for (int j = 0; j < d; j++) {
+      if (ISNAN(corr(i, j)))
+        missing = true;
+      else if (abs(corr(i, j) - corr(j, i)) > MIN_DIFF_EPS ||
+               (i == j && abs(corr(i, i) - 1.0) > MIN_DIFF_EPS))
+        Rcpp::stop("corr needs to be a correlation matrix");
+    }
+  }
+
+  if (missing || !(df > 0.0)) {
+    Rcpp::warning("NAs produced");
+    std::fill(x.begin(), x.end(), NA_REAL);
+    return x;
+  }
+
+  std::vector<double> L;
+  if (!cholesky(&corr[0], d, L))
+    Rcpp::stop("corr is not positive definite");
+
+  // margins; NULL for invalid ones, that are filled with NAs
+  std::vector<const mix_family*> margin(d, nullptr);
+  bool throw_warning = false;
+
+  if (!uniform) {
+    for (int j = 0; j < d; j++) {
+      std::string name = Rcpp::as<std::string>(family[j]);
+      const mix_family* f = find_mix_family(name);
+      if (f == nullptr)
+        Rcpp::stop("unknown margin family: " + name);
+      bool ok = true;
+      for (int l = 0; l < f->npar; l++) {
+        if (ISNAN(theta(l, j)))
+          ok = false;
+      }
+      if (ok && f->valid(&theta(0, j)))
+        margin[j] = f;
+      else
+        throw_warning = true;
+    }
+  }
+
+  bool student = R_FINITE(df);
+  std::vector<double> e(d), z(RNG_BLOCK * d);
+  double s, zj, log_p, log_q;
+
+  for (int i0 = 0; i0 < n; i0 += RNG_BLOCK) {
+
+    int b = std::min(RNG_BLOCK, n - i0);
+
+    for (int r = 0; r < b; r++) {
+      for (int j = 0; j < d; j++)
+        e[j] = R::norm_rand();
+      s = student ? sqrt(df / R::rchisq(df)) : 1.0;
+      for (int j = 0; j < d; j++) {
+        zj = 0.0;
+        for (int k = 0; k <= j; k++)
+          zj += L[j + k*d] * e[k];
+        z[j*RNG_BLOCK + r] = s * zj;
+      }
+    }
+
+    for (int j = 0; j < d; j++) {
+      if (!uniform && margin[j] == nullptr) {
+        for (int r = 0; r < b; r++)
+          x(i0 + r, j) = NA_REAL;
+        continue;
+      }
+      for (int r = 0; r < b; r++) {
+        zj = z[j*RNG_BLOCK + r];
+        if (student) {
+          log_p = R::pt(zj, df, true, true);
+          log_q = R::pt(zj, df, false, true);
+        } else {
+          log_p = R::pnorm(zj, 0.0, 1.0, true, true);
+          log_q = R::pnorm(zj, 0.0, 1.0, false, true);
+        }
+        x(i0 + r, j) = uniform ? exp(log_p) :
+          margin[j]->quantile(log_p, log_q, &theta(0, j));
+      }
+    }
+
+  }
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
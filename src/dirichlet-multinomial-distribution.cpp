@@ -67,7 +67,9 @@ NumericVector cpp_ddirmnom(
   double prod_tmp, sum_alpha, sum_x;
   bool wrong_x, wrong_param;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     
     prod_tmp = 0.0;
     sum_alpha = 0.0;
@@ -115,6 +117,7 @@ NumericVector cpp_ddirmnom(
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
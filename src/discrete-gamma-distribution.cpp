@@ -14,19 +14,47 @@ using Rcpp::NumericVector;
 
 
 /*
-* Discrete normal distribution
+* Discrete gamma distribution
 * 
 * Values:
-* x
+* x >= 0
 * 
 * Parameters
-* mu
-* sigma > 0
+* shape > 0
+* scale > 0
+* 
+* f(x) = S(x) - S(x+1)
+* F(x) = G(x+1)
+* 
+* where G and S are cdf and survival function of continuous gamma
+* distribution. Right of the mean f(x) is computed as a difference of
+* upper tails in log-space to avoid cancellation.
 *  
 */
 
 
-inline double pmf_dgamma(double x, double shape, double scale,
+inline double logpmf_dgamma(double x, double shape, double scale,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(shape) || ISNAN(scale))
+    return x+shape+scale;
+#endif
+  if (shape <= 0.0 || scale <= 0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0 || !isInteger(x) || !R_FINITE(x))
+    return R_NegInf;
+  if (x >= shape*scale) {
+    return logdiffexp(R::pgamma(x, shape, scale, false, true),
+                      R::pgamma(x+1.0, shape, scale, false, true));
+  }
+  return logdiffexp(R::pgamma(x+1.0, shape, scale, true, true),
+                    R::pgamma(x, shape, scale, true, true));
+}
+
+inline double cdf_dgamma(double x, double shape, double scale,
+                         bool lower_tail, bool log_prob,
                          bool& throw_warning) {
 #ifdef IEEE_754
   if (ISNAN(x) || ISNAN(shape) || ISNAN(scale))
@@ -36,10 +64,49 @@ inline double pmf_dgamma(double x, double shape, double scale,
     throw_warning = true;
     return NAN;
   }
-  if (x < 0.0 || !isInteger(x))
-    return 0.0;
-  return R::pgamma(x+1.0, shape, scale, true, false) -
-    R::pgamma(x, shape, scale, true, false);
+  return R::pgamma(floor(x)+1.0, shape, scale, lower_tail, log_prob);
+}
+
+inline double invcdf_dgamma(double p, double shape, double scale,
+                            bool lower_tail, bool log_prob,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(shape) || ISNAN(scale))
+    return p+shape+scale;
+#endif
+  if (shape <= 0.0 || scale <= 0 ||
+      (log_prob ? p > 0.0 : !VALID_PROB(p))) {
+    throw_warning = true;
+    return NAN;
+  }
+  
+  // smallest x such that F(x) >= p, where F(x) = G(x+1)
+  auto reached = [&](double y) -> bool {
+    double py = R::pgamma(y+1.0, shape, scale, lower_tail, log_prob);
+    return lower_tail ? py >= p : py <= p;
+  };
+  
+  // the support starts at zero, but a qgamma slightly below one may still
+  // need the correction up to one, so zero goes through the checks as well
+  double x = std::max(ceil(R::qgamma(p, shape, scale, lower_tail, log_prob)) - 1.0, 0.0);
+  if (!R_FINITE(x))
+    return x;
+  
+  // correct for inaccuracy of qgamma
+  if (x > 0.0 && reached(x - 1.0))
+    return x - 1.0;
+  if (!reached(x))
+    return x + 1.0;
+  return x;
+}
+
+inline double rng_dgamma(double shape, double scale,
+                         bool& throw_warning) {
+  if (ISNAN(shape) || ISNAN(scale) || shape <= 0.0 || scale <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  return floor(R::rgamma(shape, scale));
 }
 
 
@@ -64,16 +131,113 @@ NumericVector cpp_ddgamma(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
-    p[i] = pmf_dgamma(GETV(x, i), GETV(shape, i),
-                      GETV(scale, i), throw_warning);
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
+    p[i] = logpmf_dgamma(GETV(x, i), GETV(shape, i),
+                         GETV(scale, i), throw_warning);
+  }
   
-  if (log_prob)
-    p = Rcpp::log(p);
+  if (!log_prob)
+    p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
   return p;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_pdgamma(
+    const NumericVector& x,
+    const NumericVector& shape,
+    const NumericVector& scale,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), shape.length(), scale.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    shape.length(),
+    scale.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = cdf_dgamma(GETV(x, i), GETV(shape, i), GETV(scale, i),
+                      lower_tail, log_prob, throw_warning);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qdgamma(
+    const NumericVector& p,
+    const NumericVector& shape,
+    const NumericVector& scale,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), shape.length(), scale.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    shape.length(),
+    scale.length()
+  });
+  NumericVector x(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    x[i] = invcdf_dgamma(GETV(p, i), GETV(shape, i), GETV(scale, i),
+                         lower_tail, log_prob, throw_warning);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rdgamma(
+    const int& n,
+    const NumericVector& shape,
+    const NumericVector& scale
+  ) {
+  
+  if (std::min({shape.length(), scale.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+  
+  NumericVector x(n);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < n; i++)
+    x[i] = rng_dgamma(GETV(shape, i), GETV(scale, i),
+                      throw_warning);
+  
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+  
+  return x;
+}
+
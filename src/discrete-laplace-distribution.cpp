@@ -85,13 +85,17 @@ NumericVector cpp_ddlaplace(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = logpmf_dlaplace(GETV(x, i), GETV(scale, i),
                            GETV(location, i), throw_warning);
+  }
   
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
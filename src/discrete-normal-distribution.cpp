@@ -64,13 +64,17 @@ NumericVector cpp_ddnorm(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = pmf_dnorm(GETV(x, i), GETV(mu, i),
                      GETV(sigma, i), throw_warning);
+  }
   
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
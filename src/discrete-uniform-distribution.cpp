@@ -111,13 +111,17 @@ NumericVector cpp_ddunif(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = pmf_dunif(GETV(x, i), GETV(min, i),
                      GETV(max, i), throw_warning);
+  }
   
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -63,30 +63,54 @@ inline double cdf_dweibull(double x, double q, double beta,
   return 1.0 - exp(log(q) * exp(log1p(x) * beta));
 }
 
-inline double invcdf_dweibull(double p, double q, double beta,
-                              bool& throw_warning) {
+inline double logcens_dweibull(double x, double status, double q, double beta,
+                               bool& throw_warning) {
 #ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(q) || ISNAN(beta))
-    return p+q+beta;
+  if (ISNAN(x) || ISNAN(status) || ISNAN(q) || ISNAN(beta))
+    return x+status+q+beta;
 #endif
-  if (q <= 0.0 || q >= 1.0 || beta <= 0.0 || !VALID_PROB(p)) {
+  if (q <= 0.0 || q >= 1.0 || beta <= 0.0) {
     throw_warning = true;
     return NAN;
   }
-  if (p == 0.0)
+  // S(x) = q^((x+1)^beta), f(x) = S(x-1) - S(x)
+  double log_S = (x < 0.0) ? 0.0 : log(q) * exp(log1p(x) * beta);
+  return censored_loglik(status, [&]() {
+    if (!isInteger(x) || x < 0.0 || !R_FINITE(x))
+      return R_NegInf;
+    double log_S0 = log(q) * pow(x, beta);
+    return log_S0 + log1mexp(log_S - log_S0);
+  }, [&]() {
+    return log_S;
+  }, [&]() {
+    return log1mexp(log_S);
+  }, throw_warning);
+}
+
+/*
+ * Quantile function and random generation use log(1-p) computed directly
+ * from the given tail (-E, where E is standard exponential, in case of
+ * random generation), while log(q) and 1/beta are computed only once
+ * per distinct value of the parameters.
+ */
+
+inline double invcdf_dweibull_log(double log_s, double log_q,
+                                  double inv_beta) {
+  if (log_s == 0.0)
     return 0.0;
-  return ceil(pow(log(1.0 - p)/log(q), 1.0/beta) - 1.0);
+  return ceil(exp(log(log_s/log_q) * inv_beta) - 1.0);
 }
 
-inline double rng_dweibull(double q, double beta,
-                           bool& throw_warning) {
-  if (ISNAN(q) || ISNAN(beta) || q <= 0.0 || q >= 1.0 ||
-      beta <= 0.0) {
-    throw_warning = true;
-    return NA_REAL;
-  }
-  double u = rng_unif();
-  return ceil(pow(log(u)/log(q), 1.0/beta) - 1.0);
+inline void dweibull_constants(const NumericVector& q,
+                               const NumericVector& beta,
+                               NumericVector& log_q,
+                               NumericVector& inv_beta) {
+  log_q = NumericVector(q.length());
+  inv_beta = NumericVector(beta.length());
+  for (int i = 0; i < q.length(); i++)
+    log_q[i] = (q[i] <= 0.0 || q[i] >= 1.0) ? NAN : log(q[i]);
+  for (int i = 0; i < beta.length(); i++)
+    inv_beta[i] = (beta[i] <= 0.0) ? NAN : 1.0/beta[i];
 }
 
 
@@ -111,13 +135,17 @@ NumericVector cpp_ddweibull(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = pdf_dweibull(GETV(x, i), GETV(q, i),
                         GETV(beta, i), throw_warning);
+  }
 
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
 
@@ -183,19 +211,38 @@ NumericVector cpp_qdweibull(
     beta.length()
   });
   NumericVector x(Nmax);
-  NumericVector pp = Rcpp::clone(p);
+  NumericVector log_q, inv_beta;
+  double pi, log_s;
   
   bool throw_warning = false;
-
-  if (log_prob)
-    pp = Rcpp::exp(pp);
   
-  if (!lower_tail)
-    pp = 1.0 - pp;
+  dweibull_constants(q, beta, log_q, inv_beta);
 
-  for (int i = 0; i < Nmax; i++)
-    x[i] = invcdf_dweibull(GETV(pp, i), GETV(q, i),
-                           GETV(beta, i), throw_warning);
+  for (int i = 0; i < Nmax; i++) {
+    
+    pi = GETV(p, i);
+    
+#ifdef IEEE_754
+    if (ISNAN(pi) || ISNAN(GETV(q, i)) || ISNAN(GETV(beta, i))) {
+      x[i] = pi + GETV(q, i) + GETV(beta, i);
+      continue;
+    }
+#endif
+    
+    if (ISNAN(GETV(log_q, i)) || ISNAN(GETV(inv_beta, i)) ||
+        (log_prob ? pi > 0.0 : !VALID_PROB(pi))) {
+      throw_warning = true;
+      x[i] = NAN;
+      continue;
+    }
+    
+    if (log_prob)
+      log_s = lower_tail ? log1mexp(pi) : pi;
+    else
+      log_s = lower_tail ? log1p(-pi) : log(pi);
+    
+    x[i] = invcdf_dweibull_log(log_s, GETV(log_q, i), GETV(inv_beta, i));
+  }
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -208,7 +255,8 @@ NumericVector cpp_qdweibull(
 NumericVector cpp_rdweibull(
     const int& n,
     const NumericVector& q,
-    const NumericVector& beta
+    const NumericVector& beta,
+    const bool& sorted = false
   ) {
   
   if (std::min({q.length(), beta.length()}) < 1) {
@@ -217,12 +265,38 @@ NumericVector cpp_rdweibull(
   }
 
   NumericVector x(n);
+  NumericVector log_q, inv_beta;
   
   bool throw_warning = false;
+  
+  dweibull_constants(q, beta, log_q, inv_beta);
+  
+  if (sorted && q.length() == 1 && beta.length() == 1) {
+    if (ISNAN(log_q[0]) || ISNAN(inv_beta[0])) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    // the survival probability is u = 1 - p, taken as log1p(-p) while
+    // p is small and as log(u) in the upper tail
+    rng_sorted(x, [&](double p, double u) -> double {
+      return invcdf_dweibull_log(p < u ? log1p(-p) : log(u),
+                                 log_q[0], inv_beta[0]);
+    });
+    return x;
+  }
 
-  for (int i = 0; i < n; i++)
-    x[i] = rng_dweibull(GETV(q, i), GETV(beta, i),
-                        throw_warning);
+  for (int i = 0; i < n; i++) {
+    if (ISNAN(GETV(log_q, i)) || ISNAN(GETV(inv_beta, i))) {
+      throw_warning = true;
+      x[i] = NA_REAL;
+      continue;
+    }
+    x[i] = invcdf_dweibull_log(-R::exp_rand(), GETV(log_q, i),
+                               GETV(inv_beta, i));
+  }
+  
+  if (sorted)
+    sort_na_last(x);
   
   if (throw_warning)
     Rcpp::warning("NAs produced");
@@ -230,3 +304,44 @@ NumericVector cpp_rdweibull(
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_dweibull(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& q,
+    const NumericVector& beta,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(),
+                q.length(), beta.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    q.length(),
+    beta.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
+    p[i] = logcens_dweibull(GETV(x, i), GETV(status, i), GETV(q, i),
+                            GETV(beta, i), throw_warning);
+  }
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  report_diagnostics(p);
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
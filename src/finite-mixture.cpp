@@ -0,0 +1,578 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using std::exp;
+using std::log;
+using std::floor;
+using std::pow;
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+using Rcpp::CharacterVector;
+
+
+/*
+ * Finite mixtures of distributions from different families
+ *
+ * f(x) = alpha[1] * f1(x) + ... + alpha[k] * fk(x)
+ * F(x) = alpha[1] * F1(x) + ... + alpha[k] * Fk(x)
+ *
+ * The components are described by mix_family records (see shared.h), the
+ * ones of the families of this package are defined next to their kernels
+ * and the ones of the base R families below. The density and both tails
+ * of the cdf are computed on the log scale by log-sum-exp over the
+ * components, so the values are precise also far in the tails, e.g. when
+ * the upper tail of the mixture is dominated by a component with small
+ * weight. Since F(x) is an average of the component cdfs, the quantile
+ * lies between the smallest and the largest of the component quantiles,
+ * what gives the bracket for invcdf_newton. Random components are drawn
+ * from the alias table of the weights (Vose, 1991) in constant time.
+ *
+ */
+
+const mix_family mix_exp = {
+  "exp", 1, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    return R::dexp(x, 1.0/t[0], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::pexp(x, 1.0/t[0], lower_tail, true);
+  },
+  [](double, double log_q, const double* t) -> double {
+    return -log_q / t[0];
+  },
+  [](const double* t) -> double {
+    return R::exp_rand() / t[0];
+  }
+};
+
+const mix_family mix_gamma = {
+  "gamma", 2, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0 && t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    return R::dgamma(x, t[0], 1.0/t[1], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::pgamma(x, t[0], 1.0/t[1], lower_tail, true);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    if (log_p < log_q)
+      return R::qgamma(log_p, t[0], 1.0/t[1], true, true);
+    return R::qgamma(log_q, t[0], 1.0/t[1], false, true);
+  },
+  [](const double* t) -> double {
+    return R::rgamma(t[0], 1.0/t[1]);
+  }
+};
+
+const mix_family mix_lnorm = {
+  "lnorm", 2, false,
+  [](const double* t) -> bool {
+    return t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    return R::dlnorm(x, t[0], t[1], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::plnorm(x, t[0], t[1], lower_tail, true);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    if (log_p < log_q)
+      return R::qlnorm(log_p, t[0], t[1], true, true);
+    return R::qlnorm(log_q, t[0], t[1], false, true);
+  },
+  [](const double* t) -> double {
+    return exp(t[0] + t[1] * R::norm_rand());
+  }
+};
+
+const mix_family mix_norm = {
+  "norm", 2, false,
+  [](const double* t) -> bool {
+    return t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    return R::dnorm(x, t[0], t[1], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::pnorm(x, t[0], t[1], lower_tail, true);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    if (log_p < log_q)
+      return R::qnorm(log_p, t[0], t[1], true, true);
+    return R::qnorm(log_q, t[0], t[1], false, true);
+  },
+  [](const double* t) -> double {
+    return t[0] + t[1] * R::norm_rand();
+  }
+};
+
+const mix_family mix_weibull = {
+  "weibull", 2, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0 && t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    return R::dweibull(x, t[0], t[1], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::pweibull(x, t[0], t[1], lower_tail, true);
+  },
+  [](double, double log_q, const double* t) -> double {
+    return t[1] * pow(-log_q, 1.0/t[0]);
+  },
+  [](const double* t) -> double {
+    return t[1] * pow(R::exp_rand(), 1.0/t[0]);
+  }
+};
+
+// discrete families, used as the margins of the copulas (see copula.cpp)
+
+const mix_family mix_binom = {
+  "binom", 2, true,
+  [](const double* t) -> bool {
+    return t[0] >= 0.0 && isInteger(t[0], false) && VALID_PROB(t[1]);
+  },
+  [](double x, const double* t) -> double {
+    if (!isInteger(x, false))
+      return R_NegInf;
+    return R::dbinom(x, t[0], t[1], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::pbinom(x, t[0], t[1], lower_tail, true);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    if (log_p < log_q)
+      return R::qbinom(log_p, t[0], t[1], true, true);
+    return R::qbinom(log_q, t[0], t[1], false, true);
+  },
+  [](const double* t) -> double {
+    return R::rbinom(t[0], t[1]);
+  }
+};
+
+const mix_family mix_nbinom = {
+  "nbinom", 2, true,
+  [](const double* t) -> bool {
+    return t[0] > 0.0 && t[1] > 0.0 && t[1] <= 1.0;
+  },
+  [](double x, const double* t) -> double {
+    if (!isInteger(x, false))
+      return R_NegInf;
+    return R::dnbinom(x, t[0], t[1], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::pnbinom(x, t[0], t[1], lower_tail, true);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    if (log_p < log_q)
+      return R::qnbinom(log_p, t[0], t[1], true, true);
+    return R::qnbinom(log_q, t[0], t[1], false, true);
+  },
+  [](const double* t) -> double {
+    return R::rnbinom(t[0], t[1]);
+  }
+};
+
+const mix_family mix_pois = {
+  "pois", 1, true,
+  [](const double* t) -> bool {
+    return t[0] >= 0.0;
+  },
+  [](double x, const double* t) -> double {
+    if (!isInteger(x, false))
+      return R_NegInf;
+    return R::dpois(x, t[0], true);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    return R::ppois(x, t[0], lower_tail, true);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    if (log_p < log_q)
+      return R::qpois(log_p, t[0], true, true);
+    return R::qpois(log_q, t[0], false, true);
+  },
+  [](const double* t) -> double {
+    return R::rpois(t[0]);
+  }
+};
+
+extern const mix_family mix_frechet;
+extern const mix_family mix_gev;
+extern const mix_family mix_gompertz;
+extern const mix_family mix_gpd;
+extern const mix_family mix_gumbel;
+extern const mix_family mix_lomax;
+extern const mix_family mix_pareto;
+extern const mix_family mix_rayleigh;
+extern const mix_family mix_tbinom;
+extern const mix_family mix_tpois;
+
+const mix_family* find_mix_family(const std::string& name) {
+  static const mix_family* const families[] = {
+    &mix_binom, &mix_exp, &mix_frechet, &mix_gamma, &mix_gev, &mix_gompertz,
+    &mix_gpd, &mix_gumbel, &mix_lnorm, &mix_lomax, &mix_nbinom, &mix_norm,
+    &mix_pareto, &mix_pois, &mix_rayleigh, &mix_tbinom, &mix_tpois,
+    &mix_weibull
+  };
+  for (const mix_family* f : families) {
+    if (name == f->name)
+      return f;
+  }
+  return nullptr;
+}
+
+
+// Alias table of a discrete distribution on {0, ..., k-1}: j is drawn
+// with probability prob[j], and alias[j] otherwise
+
+struct alias_table {
+  std::vector<double> prob;
+  std::vector<int> alias;
+};
+
+// w are probabilities that sum up to 1
+inline void make_alias_table(const std::vector<double>& w, alias_table& tab) {
+
+  int k = w.size();
+  std::vector<double> r(k);
+  std::vector<int> small, large;
+
+  tab.prob.assign(k, 1.0);
+  tab.alias.resize(k);
+
+  for (int j = 0; j < k; j++) {
+    tab.alias[j] = j;
+    r[j] = w[j] * to_dbl(k);
+    if (r[j] < 1.0)
+      small.push_back(j);
+    else
+      large.push_back(j);
+  }
+
+  while (!small.empty() && !large.empty()) {
+    int s = small.back(), l = large.back();
+    small.pop_back();
+    tab.prob[s] = r[s];
+    tab.alias[s] = l;
+    r[l] -= 1.0 - r[s];
+    if (r[l] < 1.0) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // the remaining entries are equal to 1 up to rounding errors
+}
+
+inline int rng_alias(const alias_table& tab) {
+  int k = tab.prob.size();
+  double u = rng_unif() * to_dbl(k);
+  int j = std::min(static_cast<int>(floor(u)), k-1);
+  return (u - to_dbl(j) < tab.prob[j]) ? j : tab.alias[j];
+}
+
+
+struct mixture {
+  std::vector<const mix_family*> family;
+  std::vector<double> theta;      // MIX_MAX_PAR parameters per component
+  std::vector<double> log_alpha;  // normalized log-weights
+  bool missing;                   // some of the parameters are NA
+  bool valid;
+};
+
+inline mixture make_mixture(const CharacterVector& family,
+                            const NumericMatrix& theta,
+                            const NumericVector& alpha) {
+
+  int k = family.length();
+  if (theta.ncol() != k || theta.nrow() != MIX_MAX_PAR || alpha.length() != k)
+    Rcpp::stop("sizes of components and alpha do not match");
+
+  mixture m;
+  m.family.resize(k);
+  m.theta.resize(k * MIX_MAX_PAR);
+  m.log_alpha.resize(k);
+  m.missing = false;
+  m.valid = true;
+
+  double alpha_tot = 0.0;
+
+  for (int j = 0; j < k; j++) {
+    std::string name = Rcpp::as<std::string>(family[j]);
+    m.family[j] = find_mix_family(name);
+    if (m.family[j] == nullptr)
+      Rcpp::stop("unknown component family: " + name);
+    if (m.family[j]->discrete)
+      Rcpp::stop("mixtures of \"" + name + "\" distributions are not supported");
+    for (int l = 0; l < MIX_MAX_PAR; l++) {
+      m.theta[j*MIX_MAX_PAR + l] = theta(l, j);
+      if (l < m.family[j]->npar && ISNAN(theta(l, j)))
+        m.missing = true;
+    }
+    if (ISNAN(alpha[j]))
+      m.missing = true;
+    else if (alpha[j] < 0.0 || !R_FINITE(alpha[j]))
+      m.valid = false;
+    else
+      alpha_tot += alpha[j];
+  }
+
+  if (m.missing)
+    return m;
+  if (!(alpha_tot > 0.0))
+    m.valid = false;
+
+  for (int j = 0; j < k; j++) {
+    if (!m.family[j]->valid(&m.theta[j*MIX_MAX_PAR]))
+      m.valid = false;
+    m.log_alpha[j] = log(alpha[j]) - log(alpha_tot);
+  }
+
+  return m;
+}
+
+// log(sum(exp(v)))
+inline double log_sum_exp(const std::vector<double>& v) {
+  double mx = R_NegInf, s = 0.0;
+  for (double vj : v) {
+    if (vj > mx)
+      mx = vj;
+  }
+  if (!R_FINITE(mx))
+    return mx;
+  for (double vj : v)
+    s += exp(vj - mx);
+  return mx + log(s);
+}
+
+inline double logpdf_mixture(const mixture& m, double x,
+                             std::vector<double>& buff) {
+  for (std::size_t j = 0; j < m.family.size(); j++) {
+    buff[j] = (m.log_alpha[j] == R_NegInf) ? R_NegInf :
+      m.log_alpha[j] + m.family[j]->log_pdf(x, &m.theta[j*MIX_MAX_PAR]);
+  }
+  return log_sum_exp(buff);
+}
+
+inline double logcdf_mixture(const mixture& m, double x, bool lower_tail,
+                             std::vector<double>& buff) {
+  if (x == R_NegInf)
+    return lower_tail ? R_NegInf : 0.0;
+  if (x == R_PosInf)
+    return lower_tail ? 0.0 : R_NegInf;
+  for (std::size_t j = 0; j < m.family.size(); j++) {
+    buff[j] = (m.log_alpha[j] == R_NegInf) ? R_NegInf :
+      m.log_alpha[j] + m.family[j]->log_cdf(x, &m.theta[j*MIX_MAX_PAR],
+                                            lower_tail);
+  }
+  return log_sum_exp(buff);
+}
+
+// the quantile is searched for in the smaller of the tails
+inline double invcdf_mixture(const mixture& m, double log_pl, double log_pu,
+                             std::vector<double>& buff) {
+
+  double lo = R_PosInf, hi = R_NegInf, xj;
+
+  for (std::size_t j = 0; j < m.family.size(); j++) {
+    if (m.log_alpha[j] == R_NegInf)
+      continue;
+    xj = m.family[j]->quantile(log_pl, log_pu, &m.theta[j*MIX_MAX_PAR]);
+    lo = std::min(lo, xj);
+    hi = std::max(hi, xj);
+  }
+
+  if (!(lo < hi) || log_pl == R_NegInf)
+    return lo;
+  if (log_pu == R_NegInf)
+    return hi;
+
+  bool upper = log_pu < log_pl;
+
+  return invcdf_newton([&](double x, double& log_P, double& log_d, double& h) {
+    log_P = logcdf_mixture(m, x, !upper, buff);
+    log_d = logpdf_mixture(m, x, buff);
+    h = NAN;
+  }, upper ? log_pu : log_pl, upper, lo + (hi - lo)/2.0, lo, hi);
+}
+
+// fills res with NAs for missing, or with NaNs for invalid parameters
+inline bool check_mixture(const mixture& m, NumericVector& res) {
+  if (m.missing) {
+    std::fill(res.begin(), res.end(), NA_REAL);
+    return false;
+  }
+  if (!m.valid) {
+    std::fill(res.begin(), res.end(), NAN);
+    Rcpp::warning("NaNs produced");
+    return false;
+  }
+  return true;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dmix(
+    const NumericVector& x,
+    const CharacterVector& family,
+    const NumericMatrix& theta,
+    const NumericVector& alpha,
+    const bool& log_prob = false
+  ) {
+
+  if (std::min({static_cast<int>(x.length()),
+                static_cast<int>(family.length())}) < 1) {
+    return NumericVector(0);
+  }
+
+  mixture m = make_mixture(family, theta, alpha);
+  int n = x.length();
+  NumericVector p(n);
+
+  if (!check_mixture(m, p))
+    return p;
+
+  std::vector<double> buff(family.length());
+
+  for (int i = 0; i < n; i++) {
+    if (ISNAN(x[i])) {
+      p[i] = x[i];
+      continue;
+    }
+    p[i] = logpdf_mixture(m, x[i], buff);
+  }
+
+  if (!log_prob)
+    p = Rcpp::exp(p);
+
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pmix(
+    const NumericVector& x,
+    const CharacterVector& family,
+    const NumericMatrix& theta,
+    const NumericVector& alpha,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+
+  if (std::min({static_cast<int>(x.length()),
+                static_cast<int>(family.length())}) < 1) {
+    return NumericVector(0);
+  }
+
+  mixture m = make_mixture(family, theta, alpha);
+  int n = x.length();
+  NumericVector p(n);
+
+  if (!check_mixture(m, p))
+    return p;
+
+  std::vector<double> buff(family.length());
+
+  for (int i = 0; i < n; i++) {
+    if (ISNAN(x[i])) {
+      p[i] = x[i];
+      continue;
+    }
+    p[i] = logcdf_mixture(m, x[i], lower_tail, buff);
+  }
+
+  if (!log_prob)
+    p = Rcpp::exp(p);
+
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qmix(
+    const NumericVector& p,
+    const CharacterVector& family,
+    const NumericMatrix& theta,
+    const NumericVector& alpha,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+
+  if (std::min({static_cast<int>(p.length()),
+                static_cast<int>(family.length())}) < 1) {
+    return NumericVector(0);
+  }
+
+  mixture m = make_mixture(family, theta, alpha);
+  int n = p.length();
+  NumericVector x(n);
+
+  if (!check_mixture(m, x))
+    return x;
+
+  std::vector<double> buff(family.length());
+  double log_pl, log_pu;
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++) {
+    if (ISNAN(p[i])) {
+      x[i] = p[i];
+      continue;
+    }
+    if (!log_tail_probs(p[i], lower_tail, log_prob, log_pl, log_pu)) {
+      throw_warning = true;
+      x[i] = NAN;
+      continue;
+    }
+    x[i] = invcdf_mixture(m, log_pl, log_pu, buff);
+  }
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rmix(
+    const int& n,
+    const CharacterVector& family,
+    const NumericMatrix& theta,
+    const NumericVector& alpha
+  ) {
+
+  if (family.length() < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  mixture m = make_mixture(family, theta, alpha);
+  NumericVector x(n);
+
+  if (m.missing || !m.valid) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  std::vector<double> w(family.length());
+  for (int j = 0; j < family.length(); j++)
+    w[j] = exp(m.log_alpha[j]);
+  alias_table tab;
+  make_alias_table(w, tab);
+
+  int j;
+  for (int i = 0; i < n; i++) {
+    j = rng_alias(tab);
+    x[i] = m.family[j]->rng(&m.theta[j*MIX_MAX_PAR]);
+  }
+
+  return x;
+}
+
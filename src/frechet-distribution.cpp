@@ -65,6 +65,69 @@ inline double cdf_frechet(double x, double lambda, double mu,
   return exp(-pow(z, -lambda));
 }
 
+inline double log_interval_frechet(double a, double b, double lambda, double mu,
+                                   double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(a) || ISNAN(b) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
+    return a+b+lambda+mu+sigma;
+#endif
+  if (lambda <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // F(x) = exp(-t(x)) with t(x) = z^-lambda
+  double ta = (a <= mu) ? R_PosInf : pow((a-mu)/sigma, -lambda);
+  double tb = (b <= mu) ? R_PosInf : pow((b-mu)/sigma, -lambda);
+  return log_interval_prob(ta, tb);
+}
+
+inline double logcens_frechet(double x, double status, double lambda,
+                              double mu, double sigma, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
+    return x+status+lambda+mu+sigma;
+#endif
+  if (lambda <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // F(x) = exp(-z^-lambda)
+  double log_F = (x <= mu) ? R_NegInf : -pow((x-mu)/sigma, -lambda);
+  return censored_loglik(status, [&]() {
+    return logpdf_frechet(x, lambda, mu, sigma, throw_warning);
+  }, [&]() {
+    return log1mexp(log_F);
+  }, [&]() {
+    return log_F;
+  }, throw_warning);
+}
+
+inline double hazard_frechet(double x, double lambda, double mu, double sigma,
+                             bool cumulative, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma))
+    return x+lambda+mu+sigma;
+#endif
+  if (lambda <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // F(x) = exp(-t), t = z^-lambda, so h(x) = lambda/(sigma*z) * t/(exp(t)-1)
+  // and H(x) = -log(1-exp(-t)), with log(t/(exp(t)-1)) computed as
+  // log(t) - t - log(1-exp(-t)), that does not overflow for large t
+  if (x <= mu)
+    return cumulative ? 0.0 : R_NegInf;
+  double z = (x-mu)/sigma;
+  double log_t = -lambda * log(z);
+  double t = exp(log_t);
+  if (cumulative)
+    return (t == 0.0) ? lambda * log(z) : -log1mexp(-t);
+  if (t == R_PosInf)
+    return R_NegInf;
+  return log(lambda) - log(sigma) - log(z) +
+    ((t == 0.0) ? 0.0 : log_t - t - log1mexp(-t));
+}
+
 inline double invcdf_frechet(double p, double lambda, double mu,
                              double sigma, bool& throw_warning) {
 #ifdef IEEE_754
@@ -91,6 +154,53 @@ inline double rng_frechet(double lambda, double mu,
   return mu + sigma * pow(-log(u), -1.0/lambda);
 }
 
+inline double invcdf_logp_frechet(double log_p, double lambda, double mu,
+                                  double sigma) {
+  return mu + sigma * pow(-log_p, -1.0/lambda);
+}
+
+inline double invcdf_pq_frechet(double p, double q, double lambda, double mu,
+                                double sigma) {
+  return invcdf_logp_frechet(log_lower(p, q), lambda, mu, sigma);
+}
+
+inline double rng_extreme_frechet(double size, double lambda, double mu,
+                                  double sigma, bool minimum,
+                                  bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(lambda) || ISNAN(mu) || ISNAN(sigma) ||
+      size <= 0.0 || lambda <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_frechet(p, q, lambda, mu, sigma);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_frechet = {
+  "frechet", 3, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0 && t[2] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_frechet(x, t[0], t[1], t[2], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    return logcens_frechet(x, lower_tail ? CENS_LEFT : CENS_RIGHT,
+                           t[0], t[1], t[2], tw);
+  },
+  [](double log_p, double, const double* t) -> double {
+    return invcdf_logp_frechet(log_p, t[0], t[1], t[2]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_frechet(t[0], t[1], t[2], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dfrechet(
@@ -223,7 +333,8 @@ NumericVector cpp_rfrechet(
     const int& n,
     const NumericVector& lambda,
     const NumericVector& mu,
-    const NumericVector& sigma
+    const NumericVector& sigma,
+    const bool& sorted = false
   ) {
   
   if (std::min({lambda.length(), mu.length(), sigma.length()}) < 1) {
@@ -235,13 +346,179 @@ NumericVector cpp_rfrechet(
   
   bool throw_warning = false;
 
+  if (sorted && lambda.length() == 1 && mu.length() == 1 && sigma.length() == 1) {
+    if (ISNAN(lambda[0]) || ISNAN(mu[0]) || ISNAN(sigma[0]) ||
+        lambda[0] <= 0.0 || sigma[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_frechet(p, q, lambda[0], mu[0], sigma[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_frechet(GETV(lambda, i), GETV(mu, i),
                        GETV(sigma, i), throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_frechet(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& lambda,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), lambda.length(), mu.length(),
+                sigma.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_frechet(GETV(size, i), GETV(lambda, i), GETV(mu, i),
+                               GETV(sigma, i), minimum, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pfrechet_interval(
+    const NumericVector& a,
+    const NumericVector& b,
+    const NumericVector& lambda,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({a.length(), b.length(), lambda.length(),
+                mu.length(), sigma.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    a.length(),
+    b.length(),
+    lambda.length(),
+    mu.length(),
+    sigma.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = log_interval_frechet(GETV(a, i), GETV(b, i), GETV(lambda, i),
+                                GETV(mu, i), GETV(sigma, i), throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_frechet(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& lambda,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(),
+                lambda.length(), mu.length(), sigma.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    lambda.length(),
+    mu.length(),
+    sigma.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_frechet(GETV(x, i), GETV(status, i), GETV(lambda, i),
+                           GETV(mu, i), GETV(sigma, i), throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_frechet(
+    const NumericVector& x,
+    const NumericVector& lambda,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), lambda.length(), mu.length(), sigma.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    lambda.length(),
+    mu.length(),
+    sigma.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_frechet(GETV(x, i), GETV(lambda, i), GETV(mu, i),
+                          GETV(sigma, i), cumulative, throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
@@ -45,15 +45,15 @@ inline double logpmf_gpois(double x, double alpha, double beta,
 
 inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta) {
   
-  if (x < 0.0 || !R_FINITE(x) || alpha < 0.0 || beta < 0.0)
-    Rcpp::stop("inadmissible values");
+  // the caller needs to assure that the parameters are admissible
+  // and the size of the table is within the integer range
   
   int ix = to_pos_int(x);
   std::vector<double> p_tab(ix+1);
   double p, qa, ga, gax, xf, px, lp;
   
   p = beta/(1.0+beta);
-  qa = log(pow(1.0 - p, alpha));
+  qa = -alpha * log1p(beta);   // log((1-p)^alpha) without underflow
   ga = R::lgammafn(alpha);
   lp = log(p);
   
@@ -81,8 +81,6 @@ inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta)
   double dj;
   
   for (int j = 2; j <= ix; j++) {
-    if (j % 10000 == 0)
-      Rcpp::checkUserInterrupt();
     dj = to_dbl(j);
     gax += log(dj + alpha - 1.0);
     xf += log(dj);
@@ -93,6 +91,18 @@ inline std::vector<double> cdf_gpois_table(double x, double alpha, double beta)
   return p_tab;
 }
 
+// for alpha >= 1 the pmf is log-concave, the ratio of the consecutive
+// probabilities is (alpha+x)/(x+1) * beta/(1+beta); false if the table
+// would be larger than max_size
+
+inline bool gpois_mode_table(double alpha, double beta, double max_size,
+                             pmf_table& tab) {
+  double p = beta/(1.0+beta);
+  return make_mode_table([=](double x) {
+    return (alpha+x) / (x+1.0) * p;
+  }, 0.0, R_PosInf, max_size, tab);
+}
+
 inline double rng_gpois(double alpha, double beta,
                         bool& throw_warning) {
   if (ISNAN(alpha) || ISNAN(beta) || alpha <= 0.0 || beta <= 0.0) {
@@ -125,13 +135,24 @@ NumericVector cpp_dgpois(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
-    p[i] = logpmf_gpois(GETV(x, i), GETV(alpha, i),
-                        GETV(beta, i), throw_warning);
+  value_cache<3> cache(Nmax);
+  double xi, ai, bi;
+
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
+    xi = GETV(x, i);
+    ai = GETV(alpha, i);
+    bi = GETV(beta, i);
+    p[i] = cached_eval(cache, {{xi, ai, bi}}, isInteger(xi, false), [&]() {
+      return logpmf_gpois(xi, ai, bi, throw_warning);
+    });
+  }
 
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
 
@@ -162,9 +183,13 @@ NumericVector cpp_pgpois(
   bool throw_warning = false;
 
   std::map<std::tuple<int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int>, pmf_table> mode_memo;
+  std::map<std::tuple<int, int>, pmf_table>::iterator it;
   double mx = finite_max_int(x);
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
     
@@ -184,13 +209,29 @@ NumericVector cpp_pgpois(
       p[i] = 1.0;
     } else if (is_large_int(GETV(x, i))) {
       p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      note_int_coercion();
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      std::tuple<int, int> key = std::make_tuple(
         static_cast<int>(i % alpha.length()),
         static_cast<int>(i % beta.length())
-      )];
+      );
+      
+      // mode-centred table, unless the table up to max(x) is smaller
+      if (GETV(alpha, i) >= 1.0) {
+        it = mode_memo.find(key);
+        if (it == mode_memo.end()) {
+          pmf_table tab;
+          gpois_mode_table(GETV(alpha, i), GETV(beta, i), mx + 1.0, tab);
+          it = mode_memo.insert(std::make_pair(key, tab)).first;
+        }
+        if (it->second.pmf.size()) {
+          p[i] = table_cdf(it->second, GETV(x, i));
+          continue;
+        }
+      }
+      
+      std::vector<double>& tmp = memo[key];
       
       if (!tmp.size()) {
         tmp = cdf_gpois_table(mx, GETV(alpha, i), GETV(beta, i));
@@ -206,6 +247,7 @@ NumericVector cpp_pgpois(
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
 
@@ -11,6 +11,7 @@ using std::log;
 using std::floor;
 using std::ceil;
 using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
 
 using std::log1p;
 
@@ -39,57 +40,149 @@ using std::log1p;
  */
 
 
-inline double logpdf_gev(double x, double mu, double sigma,
-                         double xi, bool& throw_warning) {
+/*
+ * The terms that depend only on the parameters are computed once per
+ * parameter set (see gev_constants), what matters for the outer-product
+ * evaluation, where each parameter set is used for a whole grid of x values.
+ */
+
+struct gev_const {
+  double mu;
+  double sigma;
+  double xi;
+  double log_sigma;   // log(sigma)
+  double inv_xi;      // 1/xi
+};
+
+inline gev_const gev_constants(double mu, double sigma, double xi) {
+  gev_const k;
+  k.mu = mu;
+  k.sigma = sigma;
+  k.xi = xi;
+  k.log_sigma = log(sigma);
+  k.inv_xi = 1.0/xi;
+  return k;
+}
+
+inline double logpdf_gev(double x, const gev_const& k, bool& throw_warning) {
 #ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return x+mu+sigma+xi;
+  if (ISNAN(x) || ISNAN(k.mu) || ISNAN(k.sigma) || ISNAN(k.xi))
+    return x+k.mu+k.sigma+k.xi;
 #endif
-  if (sigma <= 0.0) {
-    Rcpp::warning("NaNs produced");
+  if (k.sigma <= 0.0) {
+    throw_warning = true;
     return NAN;
   }
-  double z = (x-mu)/sigma;
-  if (1.0+xi*z > 0.0) {
-    if (xi != 0.0) {
+  double z = (x-k.mu)/k.sigma;
+  if (1.0+k.xi*z > 0.0) {
+    if (k.xi != 0.0) {
       // 1.0/sigma * pow(1.0+xi*z, -1.0-(1.0/xi)) * exp(-pow(1.0+xi*z, -1.0/xi));
-      return -log(sigma) + log1p(xi*z) * (-1.0-(1.0/xi)) -
-        exp(log1p(xi*z) * (-1.0/xi) );
+      return -k.log_sigma + log1p(k.xi*z) * (-1.0-k.inv_xi) -
+        exp(log1p(k.xi*z) * (-k.inv_xi) );
     } else {
       // 1.0/sigma * exp(-z) * exp(-exp(-z));
-      return -log(sigma) - z - exp(-z);
+      return -k.log_sigma - z - exp(-z);
     }
   } else {
     return R_NegInf;
   }
 }
 
-inline double cdf_gev(double x, double mu, double sigma,
-                      double xi, bool& throw_warning) {
+inline double logpdf_gev(double x, double mu, double sigma,
+                         double xi, bool& throw_warning) {
+  return logpdf_gev(x, gev_constants(mu, sigma, xi), throw_warning);
+}
+
+inline double cdf_gev(double x, const gev_const& k, bool& throw_warning) {
 #ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
-    return x+mu+sigma+xi;
+  if (ISNAN(x) || ISNAN(k.mu) || ISNAN(k.sigma) || ISNAN(k.xi))
+    return x+k.mu+k.sigma+k.xi;
 #endif
-  if (sigma <= 0.0) {
-    Rcpp::warning("NaNs produced");
+  if (k.sigma <= 0.0) {
+    throw_warning = true;
     return NAN;
   }
-  double z = (x-mu)/sigma;
-  if (1.0+xi*z > 0.0) {
-    if (xi != 0.0) {
+  double z = (x-k.mu)/k.sigma;
+  if (1.0+k.xi*z > 0.0) {
+    if (k.xi != 0.0) {
       // exp(-pow(1.0+xi*z, -1.0/xi));
-      return exp(-exp(log1p(xi*z) * (-1.0/xi)));
+      return exp(-exp(log1p(k.xi*z) * (-k.inv_xi)));
     } else {
       return exp(-exp(-z));
     }
   } else {
-    if (z > 0 && z >= -1/xi)
+    if (z > 0 && z >= -k.inv_xi)
       return 1.0;
     else
       return 0.0;
   }
 }
 
+inline double cdf_gev(double x, double mu, double sigma,
+                      double xi, bool& throw_warning) {
+  return cdf_gev(x, gev_constants(mu, sigma, xi), throw_warning);
+}
+
+// t(x) such that F(x) = exp(-t(x)), the caller needs to check the parameters
+
+inline double cdf_exponent_gev(double x, const gev_const& k) {
+  double z = (x-k.mu)/k.sigma;
+  if (k.xi == 0.0)
+    return exp(-z);
+  if (1.0+k.xi*z > 0.0)
+    return exp(log1p(k.xi*z) * (-k.inv_xi));
+  return (z > 0 && z >= -k.inv_xi) ? 0.0 : R_PosInf;
+}
+
+inline double log_interval_gev(double a, double b, const gev_const& k,
+                               bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(a) || ISNAN(b) || ISNAN(k.mu) || ISNAN(k.sigma) || ISNAN(k.xi))
+    return a+b+k.mu+k.sigma+k.xi;
+#endif
+  if (k.sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  return log_interval_prob(cdf_exponent_gev(a, k), cdf_exponent_gev(b, k));
+}
+
+// F(x) = exp(-t), so h(x) = 1/sigma * t^xi * t/(exp(t)-1) and
+// H(x) = -log(1-exp(-t)), where log(t) is computed directly and
+// log(t/(exp(t)-1)) = log(t) - t - log(1-exp(-t)) does not overflow
+
+inline double hazard_gev(double x, const gev_const& k, bool cumulative,
+                         bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(k.mu) || ISNAN(k.sigma) || ISNAN(k.xi))
+    return x+k.mu+k.sigma+k.xi;
+#endif
+  if (k.sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  double z = (x-k.mu)/k.sigma;
+  double log_t;
+  if (k.xi == 0.0) {
+    log_t = -z;
+  } else if (1.0+k.xi*z > 0.0) {
+    log_t = log1p(k.xi*z) * (-k.inv_xi);
+  } else if (k.xi > 0.0) {
+    // below the lower bound of the support
+    return cumulative ? 0.0 : R_NegInf;
+  } else {
+    // above the upper bound of the support
+    return R_PosInf;
+  }
+  double t = exp(log_t);
+  if (cumulative)
+    return (t == 0.0) ? -log_t : -log1mexp(-t);
+  if (t == R_PosInf)
+    return R_NegInf;
+  return -k.log_sigma + ((k.xi == 0.0) ? 0.0 : k.xi*log_t) +
+    ((t == 0.0) ? 0.0 : log_t - t - log1mexp(-t));
+}
+
 inline double invcdf_gev(double p, double mu, double sigma,
                          double xi, bool& throw_warning) {
 #ifdef IEEE_754
@@ -97,7 +190,7 @@ inline double invcdf_gev(double p, double mu, double sigma,
     return p+mu+sigma+xi;
 #endif
   if (sigma <= 0.0 || !VALID_PROB(p)) {
-    Rcpp::warning("NaNs produced");
+    throw_warning = true;
     return NAN;
   }
   if (p == 1.0)
@@ -111,7 +204,7 @@ inline double invcdf_gev(double p, double mu, double sigma,
 inline double rng_gev(double mu, double sigma, double xi,
                       bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) || sigma <= 0.0) {
-    Rcpp::warning("NAs produced");
+    throw_warning = true;
     return NA_REAL;
   }
   double u = R::exp_rand(); // -log(rng_unif())
@@ -121,6 +214,57 @@ inline double rng_gev(double mu, double sigma, double xi,
     return mu - sigma * log(u);
 }
 
+inline double invcdf_logp_gev(double log_p, double mu, double sigma,
+                              double xi) {
+  double t = -log_p;
+  if (xi != 0.0)
+    return mu + sigma/xi * expm1(-xi * log(t));
+  return mu - sigma * log(t);
+}
+
+inline double invcdf_pq_gev(double p, double q, double mu, double sigma,
+                            double xi) {
+  return invcdf_logp_gev(log_lower(p, q), mu, sigma, xi);
+}
+
+inline double rng_extreme_gev(double size, double mu, double sigma, double xi,
+                              bool minimum, bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) ||
+      size <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_gev(p, q, mu, sigma, xi);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_gev = {
+  "gev", 3, false,
+  [](const double* t) -> bool {
+    return t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_gev(x, t[0], t[1], t[2], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    gev_const k = gev_constants(t[0], t[1], t[2]);
+    if (lower_tail)
+      return log_interval_gev(R_NegInf, x, k, tw);
+    return log_interval_gev(x, R_PosInf, k, tw);
+  },
+  [](double log_p, double, const double* t) -> double {
+    return invcdf_logp_gev(log_p, t[0], t[1], t[2]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_gev(t[0], t[1], t[2], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dgev(
@@ -251,7 +395,8 @@ NumericVector cpp_rgev(
     const int& n,
     const NumericVector& mu,
     const NumericVector& sigma,
-    const NumericVector& xi
+    const NumericVector& xi,
+    const bool& sorted = false
   ) {
   
   if (std::min({mu.length(), sigma.length(), xi.length()}) < 1) {
@@ -263,13 +408,244 @@ NumericVector cpp_rgev(
 
   bool throw_warning = false;
   
+  if (sorted && mu.length() == 1 && sigma.length() == 1 && xi.length() == 1) {
+    if (ISNAN(mu[0]) || ISNAN(sigma[0]) || ISNAN(xi[0]) || sigma[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_gev(p, q, mu[0], sigma[0], xi[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_gev(GETV(mu, i), GETV(sigma, i),
                    GETV(xi, i), throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_gev(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& xi,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), mu.length(), sigma.length(), xi.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_gev(GETV(size, i), GETV(mu, i), GETV(sigma, i),
+                           GETV(xi, i), minimum, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+/*
+ * Outer-product evaluation: p(i, j) is the density (or cdf) of x[i] for
+ * the j-th parameter set, where the parameters are recycled to the common
+ * length. The constants are computed once per parameter set and x is
+ * processed in blocks of GEV_XBLOCK values, so that the block stays in
+ * cache while it is evaluated for all the parameter sets.
+ */
+
+static const int GEV_XBLOCK = 1024;
+
+inline std::vector<gev_const> gev_constants(
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& xi
+  ) {
+  int Nmax = std::max({ mu.length(), sigma.length(), xi.length() });
+  std::vector<gev_const> k(Nmax);
+  for (int j = 0; j < Nmax; j++)
+    k[j] = gev_constants(GETV(mu, j), GETV(sigma, j), GETV(xi, j));
+  return k;
+}
+
+
+// [[Rcpp::export]]
+NumericMatrix cpp_dgev_outer(
+    const NumericVector& x,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& xi,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({mu.length(), sigma.length(), xi.length()}) < 1)
+    return NumericMatrix(x.length(), 0);
+  
+  std::vector<gev_const> k = gev_constants(mu, sigma, xi);
+  int n = x.length();
+  int m = k.size();
+  NumericMatrix p(n, m);
+  
+  bool throw_warning = false;
+  
+  for (int i0 = 0; i0 < n; i0 += GEV_XBLOCK) {
+    int i1 = std::min(n, i0 + GEV_XBLOCK);
+    for (int j = 0; j < m; j++) {
+      for (int i = i0; i < i1; i++)
+        p(i, j) = logpdf_gev(x[i], k[j], throw_warning);
+      if (!log_prob) {
+        for (int i = i0; i < i1; i++)
+          p(i, j) = exp(p(i, j));
+      }
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericMatrix cpp_pgev_outer(
+    const NumericVector& x,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& xi,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({mu.length(), sigma.length(), xi.length()}) < 1)
+    return NumericMatrix(x.length(), 0);
+  
+  std::vector<gev_const> k = gev_constants(mu, sigma, xi);
+  int n = x.length();
+  int m = k.size();
+  NumericMatrix p(n, m);
+  
+  bool throw_warning = false;
+  
+  for (int i0 = 0; i0 < n; i0 += GEV_XBLOCK) {
+    int i1 = std::min(n, i0 + GEV_XBLOCK);
+    for (int j = 0; j < m; j++) {
+      for (int i = i0; i < i1; i++)
+        p(i, j) = cdf_gev(x[i], k[j], throw_warning);
+      if (!lower_tail) {
+        for (int i = i0; i < i1; i++)
+          p(i, j) = 1.0 - p(i, j);
+      }
+      if (log_prob) {
+        for (int i = i0; i < i1; i++)
+          p(i, j) = log(p(i, j));
+      }
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pgev_interval(
+    const NumericVector& a,
+    const NumericVector& b,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& xi,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({a.length(), b.length(), mu.length(),
+                sigma.length(), xi.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    a.length(),
+    b.length(),
+    mu.length(),
+    sigma.length(),
+    xi.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = log_interval_gev(GETV(a, i), GETV(b, i),
+                            gev_constants(GETV(mu, i), GETV(sigma, i), GETV(xi, i)),
+                            throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_gev(
+    const NumericVector& x,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& xi,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), mu.length(),
+                sigma.length(), xi.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    mu.length(),
+    sigma.length(),
+    xi.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_gev(GETV(x, i),
+                      gev_constants(GETV(mu, i), GETV(sigma, i), GETV(xi, i)),
+                      cumulative, throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
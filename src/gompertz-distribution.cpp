@@ -68,6 +68,45 @@ inline double cdf_gompertz(double x, double a, double b,
   return 1.0 - exp(-a/b * (exp(b*x) - 1.0));
 }
 
+inline double logcens_gompertz(double x, double status, double a, double b,
+                               bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(a) || ISNAN(b))
+    return x+status+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // S(x) = exp(-H(x)), where H(x) = a/b * (exp(b*x) - 1) is the cumulative hazard
+  double H = (x < 0.0) ? 0.0 : a/b * expm1(b*x);
+  return censored_loglik(status, [&]() {
+    return (x < 0.0 || !R_FINITE(x)) ? R_NegInf : log(a) + b*x - H;
+  }, [&]() {
+    return -H;
+  }, [&]() {
+    return log1mexp(-H);
+  }, throw_warning);
+}
+
+inline double hazard_gompertz(double x, double a, double b, bool cumulative,
+                              bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // h(x) = a*exp(b*x), H(x) = a/b * (exp(b*x) - 1)
+  if (x < 0.0)
+    return cumulative ? 0.0 : R_NegInf;
+  if (cumulative)
+    return a/b * expm1(b*x);
+  return log(a) + b*x;
+}
+
 inline double invcdf_gompertz(double p, double a, double b,
                               bool& throw_warning) {
 #ifdef IEEE_754
@@ -90,6 +129,50 @@ inline double rng_gompertz(double a, double b, bool& throw_warning) {
   return log(1.0 - b/a * log(u)) / b;
 }
 
+inline double invcdf_logq_gompertz(double log_q, double a, double b) {
+  return log1p(-b/a * log_q) / b;
+}
+
+inline double invcdf_pq_gompertz(double p, double q, double a, double b) {
+  return invcdf_logq_gompertz(log_upper(p, q), a, b);
+}
+
+inline double rng_extreme_gompertz(double size, double a, double b,
+                                   bool minimum, bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(a) || ISNAN(b) ||
+      size <= 0.0 || a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_gompertz(p, q, a, b);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_gompertz = {
+  "gompertz", 2, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0 && t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_gompertz(x, t[0], t[1], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    return logcens_gompertz(x, lower_tail ? CENS_LEFT : CENS_RIGHT,
+                            t[0], t[1], tw);
+  },
+  [](double, double log_q, const double* t) -> double {
+    return invcdf_logq_gompertz(log_q, t[0], t[1]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_gompertz(t[0], t[1], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dgompertz(
@@ -209,7 +292,8 @@ NumericVector cpp_qgompertz(
 NumericVector cpp_rgompertz(
     const int& n,
     const NumericVector& a,
-    const NumericVector& b
+    const NumericVector& b,
+    const bool& sorted = false
   ) {
   
   if (std::min({a.length(), b.length()}) < 1) {
@@ -221,13 +305,131 @@ NumericVector cpp_rgompertz(
   
   bool throw_warning = false;
 
+  if (sorted && a.length() == 1 && b.length() == 1) {
+    if (ISNAN(a[0]) || ISNAN(b[0]) || a[0] <= 0.0 || b[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_gompertz(p, q, a[0], b[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_gompertz(GETV(a, i), GETV(b, i),
                         throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_gompertz(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& a,
+    const NumericVector& b,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), a.length(), b.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_gompertz(GETV(size, i), GETV(a, i), GETV(b, i),
+                                minimum, throw_warning);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_gompertz(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& a,
+    const NumericVector& b,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(), a.length(), b.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    a.length(),
+    b.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_gompertz(GETV(x, i), GETV(status, i), GETV(a, i), GETV(b, i),
+                            throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_gompertz(
+    const NumericVector& x,
+    const NumericVector& a,
+    const NumericVector& b,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), a.length(), b.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    a.length(),
+    b.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_gompertz(GETV(x, i), GETV(a, i), GETV(b, i), cumulative,
+                           throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
@@ -120,6 +120,58 @@ inline double cdf_gpd(double x, double mu, double sigma, double xi,
   }
 }
 
+// S(x) = exp(-u(x)), the caller needs to check the parameters
+inline double surv_exponent_gpd(double x, double mu, double sigma, double xi)
+{
+  double z = (x - mu) / sigma;
+  if (z <= 0.0)
+    return 0.0;
+  if (xi == 0.0)
+    return z;
+  if (1.0 + xi * z > 0.0)
+    return log1p(xi * z) / xi;
+  return R_PosInf;
+}
+
+// h(x) = 1/(sigma + xi*(x-mu)), H(x) = -log S(x)
+inline double hazard_gpd(double x, double mu, double sigma, double xi,
+                         bool cumulative, bool &throw_warning)
+{
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return x + mu + sigma + xi;
+#endif
+  if (sigma <= 0.0)
+  {
+    throw_warning = true;
+    return NAN;
+  }
+  if (cumulative)
+    return surv_exponent_gpd(x, mu, sigma, xi);
+  double z = (x - mu) / sigma;
+  if (z < 0.0)
+    return R_NegInf;
+  if (1.0 + xi * z <= 0.0)
+    return R_PosInf;
+  return -log(sigma) - log1p(xi * z);
+}
+
+inline double log_interval_gpd(double a, double b, double mu, double sigma,
+                               double xi, bool &throw_warning)
+{
+#ifdef IEEE_754
+  if (ISNAN(a) || ISNAN(b) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi))
+    return a + b + mu + sigma + xi;
+#endif
+  if (sigma <= 0.0)
+  {
+    throw_warning = true;
+    return NAN;
+  }
+  return log_interval_surv(surv_exponent_gpd(a, mu, sigma, xi),
+                           surv_exponent_gpd(b, mu, sigma, xi));
+}
+
 inline double invcdf_gpd(double p, double mu, double sigma, double xi,
                          bool &throw_warning)
 {
@@ -159,6 +211,58 @@ inline double rng_gpd(double mu, double sigma, double xi,
   }
 }
 
+inline double invcdf_logq_gpd(double log_q, double mu, double sigma,
+                              double xi) {
+  if (xi != 0.0)
+    return mu + sigma * expm1(-xi * log_q) / xi;
+  return mu - sigma * log_q;
+}
+
+inline double invcdf_pq_gpd(double p, double q, double mu, double sigma,
+                            double xi)
+{
+  return invcdf_logq_gpd(log_upper(p, q), mu, sigma, xi);
+}
+
+inline double rng_extreme_gpd(double size, double mu, double sigma, double xi,
+                              bool minimum, bool &throw_warning)
+{
+  if (ISNAN(size) || ISNAN(mu) || ISNAN(sigma) || ISNAN(xi) ||
+      size <= 0.0 || sigma <= 0.0)
+  {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_gpd(p, q, mu, sigma, xi);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_gpd = {
+  "gpd", 3, false,
+  [](const double* t) -> bool {
+    return t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_gpd(x, t[0], t[1], t[2], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    if (lower_tail)
+      return log_interval_gpd(R_NegInf, x, t[0], t[1], t[2], tw);
+    return log_interval_gpd(x, R_PosInf, t[0], t[1], t[2], tw);
+  },
+  [](double, double log_q, const double* t) -> double {
+    return invcdf_logq_gpd(log_q, t[0], t[1], t[2]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_gpd(t[0], t[1], t[2], tw);
+  }
+};
+
 // [[Rcpp::export]]
 NumericVector cpp_dgpd(
     const NumericVector &x,
@@ -284,7 +388,8 @@ NumericVector cpp_rgpd(
     const int &n,
     const NumericVector &mu,
     const NumericVector &sigma,
-    const NumericVector &xi)
+    const NumericVector &xi,
+    const bool &sorted = false)
 {
 
   if (std::min({mu.length(), sigma.length(), xi.length()}) < 1)
@@ -297,12 +402,142 @@ NumericVector cpp_rgpd(
 
   bool throw_warning = false;
 
+  if (sorted && mu.length() == 1 && sigma.length() == 1 && xi.length() == 1)
+  {
+    if (ISNAN(mu[0]) || ISNAN(sigma[0]) || ISNAN(xi[0]) || sigma[0] <= 0.0)
+    {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double
+    {
+      return invcdf_pq_gpd(p, q, mu[0], sigma[0], xi[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_gpd(GETV(mu, i), GETV(sigma, i),
                    GETV(xi, i), throw_warning);
 
+  if (sorted)
+    sort_na_last(x);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_gpd(
+    const int &n,
+    const NumericVector &size,
+    const NumericVector &mu,
+    const NumericVector &sigma,
+    const NumericVector &xi,
+    const bool &minimum = false)
+{
+
+  if (std::min({size.length(), mu.length(), sigma.length(), xi.length()}) < 1)
+  {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_gpd(GETV(size, i), GETV(mu, i), GETV(sigma, i),
+                           GETV(xi, i), minimum, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_pgpd_interval(
+    const NumericVector &a,
+    const NumericVector &b,
+    const NumericVector &mu,
+    const NumericVector &sigma,
+    const NumericVector &xi,
+    const bool &log_prob = false)
+{
+
+  if (std::min({a.length(), b.length(), mu.length(),
+                sigma.length(), xi.length()}) < 1)
+  {
+    return NumericVector(0);
+  }
+
+  int Nmax = std::max({a.length(),
+                       b.length(),
+                       mu.length(),
+                       sigma.length(),
+                       xi.length()});
+  NumericVector p(Nmax);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < Nmax; i++)
+    p[i] = log_interval_gpd(GETV(a, i), GETV(b, i), GETV(mu, i),
+                            GETV(sigma, i), GETV(xi, i),
+                            throw_warning);
+
+  if (!log_prob)
+    p = Rcpp::exp(p);
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_gpd(
+    const NumericVector &x,
+    const NumericVector &mu,
+    const NumericVector &sigma,
+    const NumericVector &xi,
+    const bool &cumulative = false,
+    const bool &log_prob = false)
+{
+
+  if (std::min({x.length(), mu.length(),
+                sigma.length(), xi.length()}) < 1)
+  {
+    return NumericVector(0);
+  }
+
+  int Nmax = std::max({x.length(),
+                       mu.length(),
+                       sigma.length(),
+                       xi.length()});
+  NumericVector p(Nmax);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_gpd(GETV(x, i), GETV(mu, i),
+                      GETV(sigma, i), GETV(xi, i),
+                      cumulative, throw_warning);
+
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return p;
+}
@@ -0,0 +1,288 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using std::log;
+using std::log1p;
+using std::sqrt;
+using Rcpp::NumericVector;
+using Rcpp::IntegerVector;
+
+
+/*
+ * Peaks-over-threshold: GPD fits over a sequence of thresholds
+ *
+ * The data are sorted in decreasing order once, and the thresholds are
+ * processed from the highest to the lowest one, so that the exceedances
+ * of each threshold are a growing prefix of the data. The mean excess and
+ * its variance are updated only with the new exceedances.
+ *
+ * For the excesses y = x - u the likelihood is maximized over
+ * theta = xi/sigma, with xi and sigma profiled out in closed form
+ * (Grimshaw, 1993):
+ *
+ * xi(theta) = mean(log(1 + theta*y)),  sigma(theta) = xi(theta)/theta
+ * l(theta)/n = -log(sigma(theta)) - xi(theta) - 1
+ *
+ * The root of l'(theta) is bracketed and found by the Illinois variant of
+ * regula falsi. The search starts from the fit for the previous threshold
+ * v moved to the current one, sigma(u) = sigma(v) + xi*(u - v), so only
+ * a few passes over the exceedances are needed per threshold.
+ *
+ */
+
+struct gpd_profile {
+  double sigma;
+  double xi;
+  double score;  // l'(theta)/n
+};
+
+// log(1+t)/t and (log(1+t) - t/(1+t))/t^2, by series for small t
+inline double log1p_ratio(double t) {
+  if (std::abs(t) > 1e-4)
+    return log1p(t)/t;
+  return 1.0 - t*(0.5 - t*(1.0/3.0 - t*0.25));
+}
+
+inline double log1p_excess(double t) {
+  if (std::abs(t) > 1e-3)
+    return (log1p(t) - t/(1.0 + t))/(t*t);
+  return 0.5 - t*(2.0/3.0 - t*(0.75 - t*(0.8 - t*5.0/6.0)));
+}
+
+// profile of the likelihood for the n largest values x[0] >= ... >= x[n-1]
+// exceeding u; the score is computed without the cancellation of its
+// 1/theta terms, so it is accurate also for theta near zero
+inline gpd_profile profile_gpd(const double* x, int n, double u,
+                               double theta) {
+  double sl = 0.0, sp = 0.0, sb = 0.0, y, t;
+  for (int i = 0; i < n; i++) {
+    y = x[i] - u;
+    t = theta * y;
+    sl += y * log1p_ratio(t);
+    sp += y * y * log1p_excess(t);
+    sb += y / (1.0 + t);
+  }
+  gpd_profile res;
+  res.sigma = sl / to_dbl(n);
+  res.xi = theta * res.sigma;
+  res.score = sp/sl - sb/to_dbl(n);
+  return res;
+}
+
+// maximizes the profile likelihood starting from theta, scale is the
+// mean excess used as the unit of theta; returns false if the maximum
+// was not found in maxit passes over the data
+inline bool fit_gpd(const double* x, int n, double u, double scale,
+                    int maxit, double tol, double& theta,
+                    gpd_profile& fit, int& evals) {
+
+  double lo = -1.0/(x[0] - u);  // 1 + theta*y > 0
+  double step = 0.1/scale;
+  double a, b, fa, fb, c;
+  gpd_profile pc;
+
+  fit = profile_gpd(x, n, u, theta);
+  evals = 1;
+  if (ISNAN(fit.score))
+    return false;
+  if (fit.score == 0.0)
+    return true;
+
+  // bracket the root, a with positive and b with negative score
+  a = b = theta;
+  fa = fb = fit.score;
+  while (fa > 0.0 ? fb > 0.0 : fa < 0.0) {
+    if (evals >= maxit)
+      return false;
+    if (fa > 0.0) {
+      a = b;
+      fa = fb;
+      b += step;
+      pc = profile_gpd(x, n, u, b);
+      fb = pc.score;
+    } else {
+      b = a;
+      fb = fa;
+      a = (a - step > lo) ? a - step : lo + (a - lo)/2.0;
+      pc = profile_gpd(x, n, u, a);
+      fa = pc.score;
+    }
+    evals++;
+    if (ISNAN(pc.score))
+      return false;
+    step *= 2.0;
+  }
+
+  int side = 0;
+  while (evals < maxit) {
+    c = (a*fb - b*fa)/(fb - fa);
+    if (!(c > a && c < b))
+      c = a + (b - a)/2.0;
+    fit = profile_gpd(x, n, u, c);
+    evals++;
+    theta = c;
+    if (fit.score == 0.0)
+      return true;
+    if (fit.score > 0.0) {
+      a = c;
+      fa = fit.score;
+      if (side == 1)
+        fb /= 2.0;
+      side = 1;
+    } else {
+      b = c;
+      fb = fit.score;
+      if (side == -1)
+        fa /= 2.0;
+      side = -1;
+    }
+    if ((b - a) * scale <= tol)
+      return true;
+  }
+
+  return false;
+}
+
+
+// [[Rcpp::export]]
+Rcpp::List cpp_gpd_threshold(
+    const Rcpp::List& series,
+    const NumericVector& threshold,
+    const int& min_exceed = 10,
+    const int& maxit = 100,
+    const double& tol = 1e-8
+  ) {
+
+  int S = series.length();
+  int T = threshold.length();
+  int N = S * T;
+
+  NumericVector u_out(N), mean_excess(N), se_mean_excess(N),
+                sigma(N), xi(N), se_sigma(N), se_xi(N),
+                sigma_star(N), se_sigma_star(N), loglik(N);
+  IntegerVector nexc(N), iterations(N);
+
+  // thresholds from the highest to the lowest one
+  std::vector<int> ord(T);
+  for (int j = 0; j < T; j++)
+    ord[j] = j;
+  std::sort(ord.begin(), ord.end(), [&](int i, int j) {
+    return threshold[i] > threshold[j] ||
+      (!ISNAN(threshold[i]) && ISNAN(threshold[j]));
+  });
+
+  std::vector<double> x;
+  gpd_profile fit;
+
+  for (int s = 0; s < S; s++) {
+
+    Rcpp::checkUserInterrupt();
+
+    NumericVector xs = series[s];
+    x.clear();
+    for (int i = 0; i < xs.length(); i++) {
+      if (R_FINITE(xs[i]))
+        x.push_back(xs[i]);
+    }
+    std::sort(x.begin(), x.end(), [](double a, double b) { return a > b; });
+    int n = x.size();
+
+    int k = 0, evals;
+    double mean = 0.0, m2 = 0.0, delta, u, m, v, theta = 0.0;
+    double u_prev = 0.0, sigma_prev = 0.0, xi_prev = 0.0;
+    double var_s, var_x, cov, nk, sig, lo;
+    bool have_fit = false;
+
+    for (int jj = 0; jj < T; jj++) {
+
+      int j = ord[jj];
+      int r = s*T + j;
+      u = threshold[j];
+      u_out[r] = u;
+
+      if (ISNAN(u)) {
+        nexc[r] = NA_INTEGER;
+        iterations[r] = NA_INTEGER;
+        mean_excess[r] = se_mean_excess[r] = sigma[r] = xi[r] = NA_REAL;
+        se_sigma[r] = se_xi[r] = sigma_star[r] = se_sigma_star[r] = NA_REAL;
+        loglik[r] = NA_REAL;
+        continue;
+      }
+
+      // running mean and sum of squares of the exceedances
+      while (k < n && x[k] > u) {
+        k++;
+        delta = x[k-1] - mean;
+        mean += delta/to_dbl(k);
+        m2 += delta * (x[k-1] - mean);
+      }
+
+      nk = to_dbl(k);
+      nexc[r] = k;
+      m = mean - u;
+      v = (k > 1) ? m2/(nk - 1.0) : NA_REAL;
+      mean_excess[r] = (k > 0) ? m : NA_REAL;
+      se_mean_excess[r] = (k > 1) ? sqrt(v/nk) : NA_REAL;
+
+      sigma[r] = xi[r] = se_sigma[r] = se_xi[r] = NA_REAL;
+      sigma_star[r] = se_sigma_star[r] = loglik[r] = NA_REAL;
+      iterations[r] = 0;
+
+      if (k < std::max(min_exceed, 2) || !(v > 0.0))
+        continue;
+
+      // previous fit moved to the new threshold, or moment estimates
+      lo = -1.0/(x[0] - u);
+      sig = have_fit ? sigma_prev + xi_prev*(u - u_prev) : 0.0;
+      if (sig > 0.0)
+        theta = xi_prev/sig;
+      else
+        theta = (0.5*(1.0 - m*m/v)) / (0.5*m*(1.0 + m*m/v));
+      if (!(theta > lo))
+        theta = lo/2.0;
+
+      bool converged = fit_gpd(&x[0], k, u, m, maxit, tol, theta, fit, evals);
+      iterations[r] = evals;
+      if (!converged)
+        continue;
+
+      have_fit = true;
+      u_prev = u;
+      sigma_prev = fit.sigma;
+      xi_prev = fit.xi;
+
+      sigma[r] = fit.sigma;
+      xi[r] = fit.xi;
+      sigma_star[r] = fit.sigma - fit.xi*u;
+      loglik[r] = -nk * (log(fit.sigma) + fit.xi + 1.0);
+
+      // inverse of the expected information, valid for xi > -1/2
+      if (fit.xi > -0.5) {
+        var_s = 2.0 * fit.sigma*fit.sigma * (1.0 + fit.xi) / nk;
+        var_x = (1.0 + fit.xi)*(1.0 + fit.xi) / nk;
+        cov = -fit.sigma * (1.0 + fit.xi) / nk;
+        se_sigma[r] = sqrt(var_s);
+        se_xi[r] = sqrt(var_x);
+        se_sigma_star[r] = sqrt(var_s - 2.0*u*cov + u*u*var_x);
+      }
+
+    }
+  }
+
+  return Rcpp::List::create(
+    Rcpp::Named("threshold") = u_out,
+    Rcpp::Named("nexc") = nexc,
+    Rcpp::Named("mean.excess") = mean_excess,
+    Rcpp::Named("se.mean.excess") = se_mean_excess,
+    Rcpp::Named("sigma") = sigma,
+    Rcpp::Named("xi") = xi,
+    Rcpp::Named("se.sigma") = se_sigma,
+    Rcpp::Named("se.xi") = se_xi,
+    Rcpp::Named("sigma.star") = sigma_star,
+    Rcpp::Named("se.sigma.star") = se_sigma_star,
+    Rcpp::Named("loglik") = loglik,
+    Rcpp::Named("iterations") = iterations
+  );
+}
@@ -62,6 +62,42 @@ inline double cdf_gumbel(double x, double mu, double sigma,
   return exp(-exp(-z));
 }
 
+inline double log_interval_gumbel(double a, double b, double mu, double sigma,
+                                  bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(a) || ISNAN(b) || ISNAN(mu) || ISNAN(sigma))
+    return a+b+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // F(x) = exp(-t(x)) with t(x) = exp(-z)
+  return log_interval_prob(exp(-(a-mu)/sigma), exp(-(b-mu)/sigma));
+}
+
+inline double hazard_gumbel(double x, double mu, double sigma, bool cumulative,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
+    return x+mu+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // F(x) = exp(-t), t = exp(-z), so h(x) = 1/sigma * t/(exp(t)-1)
+  // and H(x) = -log(1-exp(-t)), with log(t/(exp(t)-1)) computed as
+  // -z - t - log(1-exp(-t)), that does not overflow for large t
+  double z = (x-mu)/sigma;
+  double t = exp(-z);
+  if (cumulative)
+    return (t == 0.0) ? z : -log1mexp(-t);
+  if (t == R_PosInf)
+    return R_NegInf;
+  return -log(sigma) + ((t == 0.0) ? 0.0 : -z - t - log1mexp(-t));
+}
+
 inline double invcdf_gumbel(double p, double mu, double sigma,
                             bool& throw_warning) {
 #ifdef IEEE_754
@@ -85,6 +121,51 @@ inline double rng_gumbel(double mu, double sigma,
   return mu - sigma * log(u);
 }
 
+inline double invcdf_logp_gumbel(double log_p, double mu, double sigma) {
+  return mu - sigma * log(-log_p);
+}
+
+inline double invcdf_pq_gumbel(double p, double q, double mu, double sigma) {
+  return invcdf_logp_gumbel(log_lower(p, q), mu, sigma);
+}
+
+inline double rng_extreme_gumbel(double size, double mu, double sigma,
+                                 bool minimum, bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(mu) || ISNAN(sigma) ||
+      size <= 0.0 || sigma <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_gumbel(p, q, mu, sigma);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_gumbel = {
+  "gumbel", 2, false,
+  [](const double* t) -> bool {
+    return t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_gumbel(x, t[0], t[1], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    if (lower_tail)
+      return log_interval_gumbel(R_NegInf, x, t[0], t[1], tw);
+    return log_interval_gumbel(x, R_PosInf, t[0], t[1], tw);
+  },
+  [](double log_p, double, const double* t) -> double {
+    return invcdf_logp_gumbel(log_p, t[0], t[1]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_gumbel(t[0], t[1], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dgumbel(
@@ -204,7 +285,8 @@ NumericVector cpp_qgumbel(
 NumericVector cpp_rgumbel(
     const int& n,
     const NumericVector& mu,
-    const NumericVector& sigma
+    const NumericVector& sigma,
+    const bool& sorted = false
   ) {
   
   if (std::min({mu.length(), sigma.length()}) < 1) {
@@ -216,13 +298,131 @@ NumericVector cpp_rgumbel(
   
   bool throw_warning = false;
 
+  if (sorted && mu.length() == 1 && sigma.length() == 1) {
+    if (ISNAN(mu[0]) || ISNAN(sigma[0]) || sigma[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_gumbel(p, q, mu[0], sigma[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_gumbel(GETV(mu, i), GETV(sigma, i),
                       throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_gumbel(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), mu.length(), sigma.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_gumbel(GETV(size, i), GETV(mu, i), GETV(sigma, i),
+                              minimum, throw_warning);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_pgumbel_interval(
+    const NumericVector& a,
+    const NumericVector& b,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({a.length(), b.length(), mu.length(), sigma.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    a.length(),
+    b.length(),
+    mu.length(),
+    sigma.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = log_interval_gumbel(GETV(a, i), GETV(b, i), GETV(mu, i),
+                               GETV(sigma, i), throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_gumbel(
+    const NumericVector& x,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), mu.length(), sigma.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    mu.length(),
+    sigma.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_gumbel(GETV(x, i), GETV(mu, i), GETV(sigma, i), cumulative,
+                         throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
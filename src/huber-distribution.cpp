@@ -11,54 +11,105 @@ using std::log;
 using std::floor;
 using std::ceil;
 using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
 
 
+/*
+ * "Huber density" distribution
+ * 
+ * Values:
+ * x
+ * 
+ * Parameters:
+ * mu
+ * sigma > 0
+ * c > 0
+ * 
+ * f(x) = exp(-rho(z)) / (2*sqrt(2*pi) * (Phi(c) + phi(c)/c - 1/2)) / sigma
+ * 
+ * where z = (x-mu)/sigma and rho is Huber loss.
+ * 
+ * The terms that depend only on c are computed once per value of c
+ * (see huber_constants) and shared by all the functions below.
+ * 
+ */
+
+struct huber_const {
+  double c;
+  double phi_c;   // phi(c)
+  double Phi_mc;  // Phi(-c)
+  double A;       // 2*(Phi(c) + phi(c)/c - 1/2)
+  double log_A;   // log(sqrt(2*pi) * A), log of normalizing constant
+  double p_tail;  // probability of z < -c
+  double E_psi2;  // E[psi(Z)^2] for standard normal Z
+};
+
+inline huber_const huber_constants(double c) {
+  huber_const k;
+  k.c = c;
+  if (ISNAN(c) || c <= 0.0) {
+    k.phi_c = k.Phi_mc = k.A = k.log_A = k.p_tail = k.E_psi2 = NAN;
+    return k;
+  }
+  k.phi_c = phi(c);
+  k.Phi_mc = Phi(-c);
+  k.A = 2.0*(k.phi_c/c - k.Phi_mc + 0.5);
+  k.log_A = log(SQRT_2_PI * k.A);
+  k.p_tail = k.phi_c/(c*k.A);
+  k.E_psi2 = 1.0 - 2.0*k.Phi_mc - 2.0*c*k.phi_c + 2.0*c*c*k.Phi_mc;
+  return k;
+}
+
+inline std::vector<huber_const> huber_constants(const NumericVector& c) {
+  std::vector<huber_const> k(c.length());
+  for (int i = 0; i < c.length(); i++)
+    k[i] = huber_constants(c[i]);
+  return k;
+}
+
 inline double logpdf_huber(double x, double mu, double sigma,
-                           double c, bool& throw_warning) {
+                           const huber_const& k, bool& throw_warning) {
 #ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
-    return x+mu+sigma+c;
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(k.c))
+    return x+mu+sigma+k.c;
 #endif
-  if (sigma <= 0.0 || c <= 0.0) {
+  if (sigma <= 0.0 || k.c <= 0.0) {
     throw_warning = true;
     return NAN;
   }
   
-  double z, A, rho;
+  double z, rho;
   z = abs((x - mu)/sigma);
-  // A = 2.0*SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
-  A = LOG_2F + log(SQRT_2_PI) + log(Phi(c) + phi(c)/c - 0.5);
 
-  if (z <= c) {
+  if (z <= k.c) {
     rho = (z*z)/2.0;
   } else {
-    rho = c*z - (c*c)/2.0;
+    rho = k.c*z - (k.c*k.c)/2.0;
   }
 
   // exp(-rho)/A/sigma;
-  return -rho - A - log(sigma);
+  return -rho - k.log_A - log(sigma);
 }
 
 inline double cdf_huber(double x, double mu, double sigma,
-                        double c, bool& throw_warning) {
+                        const huber_const& k, bool& throw_warning) {
 #ifdef IEEE_754
-  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
-    return x+mu+sigma+c;
+  if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma) || ISNAN(k.c))
+    return x+mu+sigma+k.c;
 #endif
-  if (sigma <= 0.0 || c <= 0.0) {
+  if (sigma <= 0.0 || k.c <= 0.0) {
     throw_warning = true;
     return NAN;
   }
 
-  double A, z, az, p;
-  A = 2.0*(phi(c)/c - Phi(-c) + 0.5);
+  double z, az, p;
   z = (x - mu)/sigma;
   az = -abs(z);
   
-  if (az <= -c) 
-    p = exp((c*c)/2.0)/c * exp(c*az) / SQRT_2_PI/A;
+  if (az <= -k.c) 
+    p = k.p_tail * exp(k.c*(az + k.c));
   else
-    p = (phi(c)/c + Phi(az) - Phi(-c))/A;
+    p = (k.phi_c/k.c + Phi(az) - k.Phi_mc)/k.A;
   
   if (z <= 0.0)
     return p;
@@ -66,25 +117,25 @@ inline double cdf_huber(double x, double mu, double sigma,
     return 1.0 - p;
 }
 
+// quantile of the standardized distribution for p <= 0.5
+inline double invcdf_huber_lower(double p, const huber_const& k) {
+  if (p <= k.p_tail)
+    return log(p/k.p_tail)/k.c - k.c;
+  return InvPhi(p*k.A - k.phi_c/k.c + k.Phi_mc);
+}
+
 inline double invcdf_huber(double p, double mu, double sigma,
-                           double c, bool& throw_warning) {
+                           const huber_const& k, bool& throw_warning) {
 #ifdef IEEE_754
-  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(c))
-    return p+mu+sigma+c;
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma) || ISNAN(k.c))
+    return p+mu+sigma+k.c;
 #endif
-  if (sigma <= 0.0 || c <= 0.0 || !VALID_PROB(p)) {
+  if (sigma <= 0.0 || k.c <= 0.0 || !VALID_PROB(p)) {
     throw_warning = true;
     return NAN;
   }
 
-  double x, pm, A;
-  A = 2.0 * SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
-  pm = std::min(p, 1.0 - p);
-
-  if (pm <= SQRT_2_PI * phi(c)/(c*A))
-    x = log(c*pm*A)/c - c/2.0;
-  else
-    x = InvPhi(abs(1.0 - Phi(c) + pm*A/SQRT_2_PI - phi(c)/c));
+  double x = invcdf_huber_lower(std::min(p, 1.0 - p), k);
 
   if (p < 0.5)
     return mu + x*sigma;
@@ -92,23 +143,17 @@ inline double invcdf_huber(double p, double mu, double sigma,
     return mu - x*sigma;
 }
 
-inline double rng_huber(double mu, double sigma, double c,
+inline double rng_huber(double mu, double sigma, const huber_const& k,
                         bool& throw_warning) {
-  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(c) ||
-      sigma <= 0.0 || c <= 0.0) {
+  if (ISNAN(mu) || ISNAN(sigma) || ISNAN(k.c) ||
+      sigma <= 0.0 || k.c <= 0.0) {
     throw_warning = true;
     return NA_REAL;
   }
   
-  double x, pm, A, u;
-  u = rng_unif();
-  A = 2.0 * SQRT_2_PI * (Phi(c) + phi(c)/c - 0.5);
-  pm = std::min(u, 1.0 - u);
-  
-  if (pm <= SQRT_2_PI * phi(c)/(c*A))
-    x = log(c*pm*A)/c - c/2.0;
-  else
-    x = InvPhi(abs(1.0 - Phi(c) + pm*A/SQRT_2_PI - phi(c)/c));
+  // u is uniform on (0, 0.5) and the sign is random
+  double u = rng_unif();
+  double x = invcdf_huber_lower(std::min(u, 1.0 - u), k);
   
   if (u < 0.5)
     return mu + x*sigma;
@@ -116,6 +161,26 @@ inline double rng_huber(double mu, double sigma, double c,
     return mu - x*sigma;
 }
 
+inline double invcdf_pq_huber(double p, double q, double mu, double sigma,
+                              const huber_const& k) {
+  if (p < q)
+    return mu + sigma * invcdf_huber_lower(p, k);
+  return mu - sigma * invcdf_huber_lower(q, k);
+}
+
+inline double rng_extreme_huber(double size, double mu, double sigma,
+                                const huber_const& k, bool minimum,
+                                bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(mu) || ISNAN(sigma) || ISNAN(k.c) ||
+      size <= 0.0 || sigma <= 0.0 || k.c <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_huber(p, q, mu, sigma, k);
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dhuber(
@@ -138,13 +203,13 @@ NumericVector cpp_dhuber(
     epsilon.length()
   });
   NumericVector p(Nmax);
+  std::vector<huber_const> k = huber_constants(epsilon);
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = logpdf_huber(GETV(x, i), GETV(mu, i),
-                        GETV(sigma, i), GETV(epsilon, i),
-                        throw_warning);
+    p[i] = logpdf_huber(GETV(x, i), GETV(mu, i), GETV(sigma, i),
+                        k[i % k.size()], throw_warning);
   
   if (!log_prob)
     p = Rcpp::exp(p);
@@ -178,13 +243,13 @@ NumericVector cpp_phuber(
     epsilon.length()
   });
   NumericVector p(Nmax);
+  std::vector<huber_const> k = huber_constants(epsilon);
   
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = cdf_huber(GETV(x, i), GETV(mu, i),
-                     GETV(sigma, i), GETV(epsilon, i),
-                     throw_warning);
+    p[i] = cdf_huber(GETV(x, i), GETV(mu, i), GETV(sigma, i),
+                     k[i % k.size()], throw_warning);
   
   if (!lower_tail)
     p = 1.0 - p;
@@ -222,6 +287,7 @@ NumericVector cpp_qhuber(
   });
   NumericVector q(Nmax);
   NumericVector pp = Rcpp::clone(p);
+  std::vector<huber_const> k = huber_constants(epsilon);
   
   bool throw_warning = false;
   
@@ -232,9 +298,8 @@ NumericVector cpp_qhuber(
     pp = 1.0 - pp;
   
   for (int i = 0; i < Nmax; i++)
-    q[i] = invcdf_huber(GETV(pp, i), GETV(mu, i),
-                        GETV(sigma, i), GETV(epsilon, i),
-                        throw_warning);
+    q[i] = invcdf_huber(GETV(pp, i), GETV(mu, i), GETV(sigma, i),
+                        k[i % k.size()], throw_warning);
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -248,7 +313,8 @@ NumericVector cpp_rhuber(
     const int& n,
     const NumericVector& mu,
     const NumericVector& sigma,
-    const NumericVector& epsilon
+    const NumericVector& epsilon,
+    const bool& sorted = false
   ) {
   
   if (std::min({mu.length(), sigma.length(), epsilon.length()}) < 1) {
@@ -257,16 +323,489 @@ NumericVector cpp_rhuber(
   }
   
   NumericVector x(n);
+  std::vector<huber_const> k = huber_constants(epsilon);
   
   bool throw_warning = false;
   
-  for (int i = 0; i < n; i++)
-    x[i] = rng_huber(GETV(mu, i), GETV(sigma, i),
-                     GETV(epsilon, i), throw_warning);
+  if (sorted && mu.length() == 1 && sigma.length() == 1 &&
+      epsilon.length() == 1) {
+    if (ISNAN(mu[0]) || ISNAN(sigma[0]) || ISNAN(k[0].c) ||
+        sigma[0] <= 0.0 || k[0].c <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_huber(p, q, mu[0], sigma[0], k[0]);
+    });
+    return x;
+  }
+
+  if (k.size() == 1 && !ISNAN(k[0].c) && k[0].c > 0.0) {
+    
+    // single epsilon: the uniforms are drawn in blocks and inverted in
+    // a separate pass over the block, with the constants of k[0] fixed
+    std::vector<double> z(RNG_BLOCK);
+    double u, m, s;
+    
+    for (int i0 = 0; i0 < n; i0 += RNG_BLOCK) {
+      int b = std::min(RNG_BLOCK, n - i0);
+      for (int r = 0; r < b; r++)
+        z[r] = rng_unif();
+      for (int r = 0; r < b; r++) {
+        u = z[r];
+        z[r] = invcdf_huber_lower(std::min(u, 1.0 - u), k[0]);
+        if (u >= 0.5)
+          z[r] = -z[r];
+      }
+      for (int r = 0; r < b; r++) {
+        int i = i0 + r;
+        m = GETV(mu, i);
+        s = GETV(sigma, i);
+        if (ISNAN(m) || ISNAN(s) || s <= 0.0) {
+          throw_warning = true;
+          x[i] = NA_REAL;
+        } else {
+          x[i] = m + z[r]*s;
+        }
+      }
+    }
+    
+  } else {
+    
+    for (int i = 0; i < n; i++)
+      x[i] = rng_huber(GETV(mu, i), GETV(sigma, i),
+                       k[i % k.size()], throw_warning);
+    
+  }
   
+  if (sorted)
+    sort_na_last(x);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_huber(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const NumericVector& epsilon,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), mu.length(), sigma.length(),
+                epsilon.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+  std::vector<huber_const> k = huber_constants(epsilon);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_huber(GETV(size, i), GETV(mu, i), GETV(sigma, i),
+                             k[i % k.size()], minimum, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+
+/*
+ * Huber loss, psi and weight functions and M-estimation
+ * 
+ * rho(z) = z^2/2           if |z| <= c
+ *          c|z| - c^2/2    otherwise
+ * psi(z) = max(-c, min(z, c))
+ * w(z)   = psi(z)/z = min(1, c/|z|)
+ * 
+ * Scale is estimated either by normalized median absolute deviation,
+ * or using Huber's proposal 2, i.e. s solving
+ * 
+ * sum(psi(r/s)^2) = (n-p) * E[psi(Z)^2]
+ * 
+ * Linear model is fitted by iteratively reweighted least squares,
+ * starting from the ordinary least squares fit.
+ * 
+ */
+
+static const double MAD_CONST = 1.482602218505602; // 1/qnorm(0.75)
+
+inline double rho_huber(double z, double c) {
+  double az = abs(z);
+  if (az <= c)
+    return (z*z)/2.0;
+  return c*az - (c*c)/2.0;
+}
+
+inline double psi_huber(double z, double c) {
+  return z < -c ? -c : (z > c ? c : z);
+}
+
+inline double weight_huber(double z, double c) {
+  double az = abs(z);
+  return az <= c ? 1.0 : c/az;
+}
+
+inline double mad_scale(const std::vector<double>& r,
+                        std::vector<double>& work) {
+  int n = r.size();
+  work.resize(n);
+  for (int i = 0; i < n; i++)
+    work[i] = abs(r[i]);
+  int h = n / 2;
+  std::nth_element(work.begin(), work.begin() + h, work.end());
+  double med = work[h];
+  if (n % 2 == 0)
+    med = (med + *std::max_element(work.begin(), work.begin() + h))/2.0;
+  return MAD_CONST * med;
+}
+
+// single fixed-point update of the proposal 2 scale
+inline double proposal2_scale(const std::vector<double>& r, double s,
+                              double df, const huber_const& k) {
+  double sum = 0.0, cs = k.c * s;
+  for (size_t i = 0; i < r.size(); i++)
+    sum += std::min(r[i]*r[i], cs*cs);
+  return sqrt(sum/(df * k.E_psi2));
+}
+
+inline double huber_scale(const std::vector<double>& r, double s0,
+                          double df, const huber_const& k,
+                          bool proposal2, int maxit, double tol,
+                          std::vector<double>& work) {
+  double s = (s0 > 0.0) ? s0 : mad_scale(r, work);
+  if (!proposal2 || s == 0.0)
+    return s;
+  double s_new;
+  for (int it = 0; it < maxit; it++) {
+    s_new = proposal2_scale(r, s, df, k);
+    if (abs(s_new - s) <= tol * s)
+      return s_new;
+    s = s_new;
+  }
+  return s;
+}
+
+// solves A b = v in place for symmetric positive definite A (p x p)
+inline bool cholesky_solve(std::vector<double>& A, std::vector<double>& v,
+                           int p) {
+  for (int j = 0; j < p; j++) {
+    double d = A[j*p + j];
+    for (int l = 0; l < j; l++)
+      d -= A[j*p + l] * A[j*p + l];
+    if (d <= 0.0)
+      return false;
+    d = sqrt(d);
+    A[j*p + j] = d;
+    for (int i = j+1; i < p; i++) {
+      double t = A[i*p + j];
+      for (int l = 0; l < j; l++)
+        t -= A[i*p + l] * A[j*p + l];
+      A[i*p + j] = t/d;
+    }
+  }
+  for (int i = 0; i < p; i++) {
+    for (int l = 0; l < i; l++)
+      v[i] -= A[i*p + l] * v[l];
+    v[i] /= A[i*p + i];
+  }
+  for (int i = p-1; i >= 0; i--) {
+    for (int l = i+1; l < p; l++)
+      v[i] -= A[l*p + i] * v[l];
+    v[i] /= A[i*p + i];
+  }
+  return true;
+}
+
+// weighted least squares, X'WX and X'Wy are accumulated over row blocks
+inline bool wls_fit(const NumericMatrix& X, const NumericVector& y,
+                    const std::vector<double>& w, std::vector<double>& b) {
+  
+  const int block = 256;
+  int n = X.nrow();
+  int p = X.ncol();
+  std::vector<double> XtWX(p*p, 0.0);
+  std::vector<double> XtWy(p, 0.0);
+  const double* Xp = &X[0];
+  
+  for (int i0 = 0; i0 < n; i0 += block) {
+    int i1 = std::min(n, i0 + block);
+    for (int j = 0; j < p; j++) {
+      const double* xj = Xp + static_cast<size_t>(j)*n;
+      double sy = 0.0;
+      for (int i = i0; i < i1; i++)
+        sy += w[i] * xj[i] * y[i];
+      XtWy[j] += sy;
+      for (int l = 0; l <= j; l++) {
+        const double* xl = Xp + static_cast<size_t>(l)*n;
+        double sx = 0.0;
+        for (int i = i0; i < i1; i++)
+          sx += w[i] * xj[i] * xl[i];
+        XtWX[j*p + l] += sx;
+      }
+    }
+  }
+  
+  b = XtWy;
+  return cholesky_solve(XtWX, b, p);
+}
+
+inline void fitted_residuals(const NumericMatrix& X, const NumericVector& y,
+                             const std::vector<double>& b,
+                             std::vector<double>& r) {
+  int n = X.nrow();
+  int p = X.ncol();
+  const double* Xp = &X[0];
+  for (int i = 0; i < n; i++)
+    r[i] = y[i];
+  for (int j = 0; j < p; j++) {
+    const double* xj = Xp + static_cast<size_t>(j)*n;
+    for (int i = 0; i < n; i++)
+      r[i] -= xj[i] * b[j];
+  }
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_huber_rho(
+    const NumericVector& x,
+    const NumericVector& epsilon
+  ) {
+  
+  if (std::min({x.length(), epsilon.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    epsilon.length()
+  });
+  NumericVector out(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++) {
+    if (ISNAN(GETV(x, i)) || ISNAN(GETV(epsilon, i))) {
+      out[i] = GETV(x, i) + GETV(epsilon, i);
+    } else if (GETV(epsilon, i) <= 0.0) {
+      throw_warning = true;
+      out[i] = NAN;
+    } else {
+      out[i] = rho_huber(GETV(x, i), GETV(epsilon, i));
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return out;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_huber_psi(
+    const NumericVector& x,
+    const NumericVector& epsilon
+  ) {
+  
+  if (std::min({x.length(), epsilon.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    epsilon.length()
+  });
+  NumericVector out(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++) {
+    if (ISNAN(GETV(x, i)) || ISNAN(GETV(epsilon, i))) {
+      out[i] = GETV(x, i) + GETV(epsilon, i);
+    } else if (GETV(epsilon, i) <= 0.0) {
+      throw_warning = true;
+      out[i] = NAN;
+    } else {
+      out[i] = psi_huber(GETV(x, i), GETV(epsilon, i));
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return out;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_huber_weight(
+    const NumericVector& x,
+    const NumericVector& epsilon
+  ) {
+  
+  if (std::min({x.length(), epsilon.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    epsilon.length()
+  });
+  NumericVector out(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++) {
+    if (ISNAN(GETV(x, i)) || ISNAN(GETV(epsilon, i))) {
+      out[i] = GETV(x, i) + GETV(epsilon, i);
+    } else if (GETV(epsilon, i) <= 0.0) {
+      throw_warning = true;
+      out[i] = NAN;
+    } else {
+      out[i] = weight_huber(GETV(x, i), GETV(epsilon, i));
+    }
+  }
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return out;
+}
+
+
+// [[Rcpp::export]]
+double cpp_huber_scale(
+    const NumericVector& x,
+    const double& epsilon = 1.345,
+    const bool& proposal2 = false,
+    const int& maxit = 50,
+    const double& tol = 1e-6
+  ) {
+  
+  if (x.length() < 1)
+    return NA_REAL;
+  
+  for (int i = 0; i < x.length(); i++) {
+    if (ISNAN(x[i]))
+      return NA_REAL;
+  }
+  
+  huber_const k = huber_constants(epsilon);
+  
+  if (ISNAN(k.c)) {
+    Rcpp::warning("NaNs produced");
+    return NAN;
+  }
+  
+  std::vector<double> r(x.begin(), x.end());
+  std::vector<double> work;
+  
+  return huber_scale(r, 0.0, to_dbl(x.length()), k,
+                     proposal2, maxit, tol, work);
+}
+
+
+// [[Rcpp::export]]
+Rcpp::List cpp_huber_irls(
+    const NumericMatrix& X,
+    const NumericVector& y,
+    const double& epsilon = 1.345,
+    const bool& proposal2 = false,
+    const int& maxit = 50,
+    const double& tol = 1e-6
+  ) {
+  
+  int n = X.nrow();
+  int p = X.ncol();
+  
+  if (n != y.length())
+    Rcpp::stop("number of rows in x does not equal length of y");
+  if (n <= p || p < 1)
+    Rcpp::stop("number of observations must be greater than number of columns in x");
+  
+  for (int i = 0; i < X.length(); i++) {
+    if (!R_FINITE(X[i]))
+      Rcpp::stop("x contains missing or infinite values");
+  }
+  for (int i = 0; i < n; i++) {
+    if (!R_FINITE(y[i]))
+      Rcpp::stop("y contains missing or infinite values");
+  }
+  
+  huber_const k = huber_constants(epsilon);
+  if (ISNAN(k.c))
+    Rcpp::stop("epsilon must be positive");
+  
+  double df = to_dbl(n - p);
+  std::vector<double> w(n, 1.0), r(n), r_old(n), b(p), work;
+  double s = 0.0, num, den;
+  bool converged = false;
+  int it;
+  
+  // ordinary least squares as a starting point
+  if (!wls_fit(X, y, w, b))
+    Rcpp::stop("singular design matrix");
+  fitted_residuals(X, y, b, r);
+  
+  for (it = 1; it <= maxit; it++) {
+    
+    Rcpp::checkUserInterrupt();
+    
+    // with proposal 2, MAD is used only as a starting value
+    if (!proposal2 || it == 1)
+      s = mad_scale(r, work);
+    if (proposal2)
+      s = proposal2_scale(r, s, df, k);
+    
+    if (s == 0.0) {
+      converged = true;
+      break;
+    }
+    
+    for (int i = 0; i < n; i++)
+      w[i] = weight_huber(r[i]/s, k.c);
+    
+    if (!wls_fit(X, y, w, b))
+      Rcpp::stop("singular design matrix");
+    
+    r_old.swap(r);
+    fitted_residuals(X, y, b, r);
+    
+    num = 0.0;
+    den = 0.0;
+    for (int i = 0; i < n; i++) {
+      num += (r_old[i] - r[i]) * (r_old[i] - r[i]);
+      den += r_old[i] * r_old[i];
+    }
+    
+    if (sqrt(num/std::max(1e-20, den)) < tol) {
+      converged = true;
+      break;
+    }
+    
+  }
+  
+  if (!converged)
+    Rcpp::warning("IRLS did not converge in %d iterations", maxit);
+  
+  return Rcpp::List::create(
+    Rcpp::Named("coefficients") = NumericVector(b.begin(), b.end()),
+    Rcpp::Named("residuals") = NumericVector(r.begin(), r.end()),
+    Rcpp::Named("weights") = NumericVector(w.begin(), w.end()),
+    Rcpp::Named("scale") = s,
+    Rcpp::Named("iterations") = std::min(it, maxit),
+    Rcpp::Named("converged") = converged
+  );
+}
@@ -86,6 +86,22 @@ inline double rng_kumar(double a, double b, bool& throw_warning) {
   return pow(1.0 - pow(u, 1.0/b), 1.0/a);
 }
 
+inline double invcdf_pq_kumar(double p, double q, double a, double b) {
+  return pow(-expm1(log_upper(p, q) / b), 1.0/a);
+}
+
+inline double rng_extreme_kumar(double size, double a, double b, bool minimum,
+                                bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(a) || ISNAN(b) ||
+      size <= 0.0 || a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_kumar(p, q, a, b);
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dkumar(
@@ -205,7 +221,8 @@ NumericVector cpp_qkumar(
 NumericVector cpp_rkumar(
     const int& n,
     const NumericVector& a,
-    const NumericVector& b
+    const NumericVector& b,
+    const bool& sorted = false
   ) {
   
   if (std::min({a.length(), b.length()}) < 1) {
@@ -217,10 +234,53 @@ NumericVector cpp_rkumar(
   
   bool throw_warning = false;
 
+  if (sorted && a.length() == 1 && b.length() == 1) {
+    if (ISNAN(a[0]) || ISNAN(b[0]) || a[0] <= 0.0 || b[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_kumar(p, q, a[0], b[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_kumar(GETV(a, i), GETV(b, i),
                      throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_kumar(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& a,
+    const NumericVector& b,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), a.length(), b.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_kumar(GETV(size, i), GETV(a, i), GETV(b, i), minimum,
+                             throw_warning);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
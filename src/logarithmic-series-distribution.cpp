@@ -60,7 +60,7 @@ inline double cdf_lgser(double x, double theta, bool& throw_warning) {
   if (!R_FINITE(x))
     return 1.0;
   if (is_large_int(x)) {
-    Rcpp::warning("NAs introduced by coercion to integer range");
+    note_int_coercion();
     return NA_REAL;
   }
   
@@ -142,13 +142,17 @@ NumericVector cpp_dlgser(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = logpdf_lgser(GETV(x, i), GETV(theta, i),
                         throw_warning);
+  }
  
  if (!log_prob)
    p = Rcpp::exp(p);
  
+ report_diagnostics(p);
  if (throw_warning)
    Rcpp::warning("NaNs produced");
 
@@ -176,9 +180,12 @@ NumericVector cpp_plgser(
   
   bool throw_warning = false;
 
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = cdf_lgser(GETV(x, i), GETV(theta, i),
                      throw_warning);
+  }
 
   if (!lower_tail)
     p = 1.0 - p;
@@ -186,6 +193,7 @@ NumericVector cpp_plgser(
   if (log_prob)
     p = Rcpp::log(p);
 
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -64,6 +64,61 @@ inline double cdf_lomax(double x, double lambda, double kappa,
   return 1.0 - exp(log1p(lambda*x) * (-kappa));
 }
 
+inline double log_interval_lomax(double a, double b, double lambda,
+                                 double kappa, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(a) || ISNAN(b) || ISNAN(lambda) || ISNAN(kappa))
+    return a+b+lambda+kappa;
+#endif
+  if (lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // S(x) = exp(-u(x)) with u(x) = kappa * log(1+lambda*x)
+  double ua = (a <= 0.0) ? 0.0 : kappa * log1p(lambda*a);
+  double ub = (b <= 0.0) ? 0.0 : kappa * log1p(lambda*b);
+  return log_interval_surv(ua, ub);
+}
+
+inline double logcens_lomax(double x, double status, double lambda, double kappa,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(lambda) || ISNAN(kappa))
+    return x+status+lambda+kappa;
+#endif
+  if (lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // S(x) = (1+lambda*x)^-kappa
+  double log_S = (x <= 0.0) ? 0.0 : log1p(lambda*x) * (-kappa);
+  return censored_loglik(status, [&]() {
+    return logpdf_lomax(x, lambda, kappa, throw_warning);
+  }, [&]() {
+    return log_S;
+  }, [&]() {
+    return log1mexp(log_S);
+  }, throw_warning);
+}
+
+inline double hazard_lomax(double x, double lambda, double kappa,
+                           bool cumulative, bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(lambda) || ISNAN(kappa))
+    return x+lambda+kappa;
+#endif
+  if (lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // h(x) = lambda*kappa / (1+lambda*x), H(x) = kappa * log(1+lambda*x)
+  if (x <= 0.0)
+    return cumulative ? 0.0 : R_NegInf;
+  if (cumulative)
+    return kappa * log1p(lambda*x);
+  return log(lambda) + log(kappa) - log1p(lambda*x);
+}
+
 inline double invcdf_lomax(double p, double lambda, double kappa,
                            bool& throw_warning) {
 #ifdef IEEE_754
@@ -86,6 +141,50 @@ inline double rng_lomax(double lambda, double kappa, bool& throw_warning) {
   return (pow(u, -1.0/kappa)-1.0) / lambda;
 }
 
+inline double invcdf_logq_lomax(double log_q, double lambda, double kappa) {
+  return expm1(-log_q / kappa) / lambda;
+}
+
+inline double invcdf_pq_lomax(double p, double q, double lambda, double kappa) {
+  return invcdf_logq_lomax(log_upper(p, q), lambda, kappa);
+}
+
+inline double rng_extreme_lomax(double size, double lambda, double kappa,
+                                bool minimum, bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(lambda) || ISNAN(kappa) ||
+      size <= 0.0 || lambda <= 0.0 || kappa <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_lomax(p, q, lambda, kappa);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_lomax = {
+  "lomax", 2, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0 && t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_lomax(x, t[0], t[1], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    return logcens_lomax(x, lower_tail ? CENS_LEFT : CENS_RIGHT,
+                         t[0], t[1], tw);
+  },
+  [](double, double log_q, const double* t) -> double {
+    return invcdf_logq_lomax(log_q, t[0], t[1]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_lomax(t[0], t[1], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dlomax(
@@ -205,7 +304,8 @@ NumericVector cpp_qlomax(
 NumericVector cpp_rlomax(
     const int& n,
     const NumericVector& lambda,
-    const NumericVector& kappa
+    const NumericVector& kappa,
+    const bool& sorted = false
   ) {
   
   if (std::min({lambda.length(), kappa.length()}) < 1) {
@@ -217,13 +317,170 @@ NumericVector cpp_rlomax(
   
   bool throw_warning = false;
 
+  if (sorted && lambda.length() == 1 && kappa.length() == 1) {
+    if (ISNAN(lambda[0]) || ISNAN(kappa[0]) || lambda[0] <= 0.0 || kappa[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_lomax(p, q, lambda[0], kappa[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_lomax(GETV(lambda, i), GETV(kappa, i),
                      throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_lomax(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& lambda,
+    const NumericVector& kappa,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), lambda.length(), kappa.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_lomax(GETV(size, i), GETV(lambda, i), GETV(kappa, i),
+                             minimum, throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_plomax_interval(
+    const NumericVector& a,
+    const NumericVector& b,
+    const NumericVector& lambda,
+    const NumericVector& kappa,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({a.length(), b.length(),
+                lambda.length(), kappa.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    a.length(),
+    b.length(),
+    lambda.length(),
+    kappa.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = log_interval_lomax(GETV(a, i), GETV(b, i), GETV(lambda, i),
+                              GETV(kappa, i), throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_lomax(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& lambda,
+    const NumericVector& kappa,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(),
+                lambda.length(), kappa.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    lambda.length(),
+    kappa.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_lomax(GETV(x, i), GETV(status, i), GETV(lambda, i),
+                         GETV(kappa, i), throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_lomax(
+    const NumericVector& x,
+    const NumericVector& lambda,
+    const NumericVector& kappa,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), lambda.length(), kappa.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    lambda.length(),
+    kappa.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_lomax(GETV(x, i), GETV(lambda, i), GETV(kappa, i), cumulative,
+                        throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
@@ -46,7 +46,9 @@ NumericVector cpp_dmixpois(
   bool wrong_param;
   double alpha_tot, nans_sum;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     wrong_param = false;
     alpha_tot = 0.0;
     nans_sum = 0.0;
@@ -106,6 +108,7 @@ NumericVector cpp_dmixpois(
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -59,7 +59,9 @@ NumericVector cpp_dmnom(
   double n_fac, prod_xfac, prod_pow_px, sum_x, p_tot;
   bool wrong_param, wrong_x;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     
     sum_x = 0.0;
     p_tot = 0.0;
@@ -110,6 +112,7 @@ NumericVector cpp_dmnom(
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
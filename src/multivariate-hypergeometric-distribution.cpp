@@ -1,5 +1,6 @@
 #include <Rcpp.h>
 #include "shared.h"
+#include <unordered_set>
 // [[Rcpp::interfaces(r, cpp)]]
 // [[Rcpp::plugins(cpp11)]]
 
@@ -61,7 +62,9 @@ NumericVector cpp_dmvhyper(
   bool wrong_n, wrong_x;
   double lNck, sum_x, lncx_prod, n_tot;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     
     wrong_x = false;
     wrong_n = false;
@@ -111,6 +114,7 @@ NumericVector cpp_dmvhyper(
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -118,6 +122,120 @@ NumericVector cpp_dmvhyper(
 }
 
 
+/*
+ * Random generation
+ * 
+ * Setup for each row of n (validation, total N, cumulative counts and
+ * order of categories by decreasing count) is computed once and reused
+ * for all the draws using that row. Then, with k' = min(k, N-k):
+ * 
+ * - if k' <= m, the indexes of k' balls are sampled without replacement
+ *   (Floyd's algorithm) and mapped to categories by binary search of
+ *   cumulative counts; when k > N/2 the sampled balls are the ones that
+ *   are left in the urn,
+ * - otherwise, x[j] are drawn from conditional hypergeometric distributions,
+ *   starting from the largest category and stopping as soon as all k balls
+ *   were assigned.
+ * 
+ */
+
+struct mvhyper_setup {
+  bool ready;
+  bool valid;
+  double n_tot;
+  std::vector<double> n_cum;  // cumulative counts
+  std::vector<int> order;     // categories sorted by decreasing count
+  std::vector<double> n_otr;  // number of balls in categories after order[j]
+};
+
+inline void mvhyper_prepare(const NumericMatrix& n, int row,
+                            mvhyper_setup& s) {
+  
+  int m = n.ncol();
+  s.ready = true;
+  s.valid = true;
+  s.n_tot = 0.0;
+  s.n_cum.resize(m);
+  s.order.resize(m);
+  s.n_otr.resize(m);
+  
+  for (int j = 0; j < m; j++) {
+    if (ISNAN(n(row, j)) || !isInteger(n(row, j), false) ||
+        n(row, j) < 0.0) {
+      s.valid = false;
+      return;
+    }
+    s.n_tot += n(row, j);
+    s.n_cum[j] = s.n_tot;
+    s.order[j] = j;
+  }
+  
+  std::stable_sort(s.order.begin(), s.order.end(), [&](int a, int b) {
+    return n(row, a) > n(row, b);
+  });
+  
+  s.n_otr[m-1] = 0.0;
+  for (int j = m-2; j >= 0; j--)
+    s.n_otr[j] = s.n_otr[j+1] + n(row, s.order[j+1]);
+}
+
+inline void rng_mvhyper_index(const NumericMatrix& n, int row,
+                              const mvhyper_setup& s, double k,
+                              std::vector<double>& x,
+                              std::unordered_set<double>& drawn) {
+  
+  int m = n.ncol();
+  bool complement = k > s.n_tot - k;
+  double kk = complement ? s.n_tot - k : k;
+  double t;
+  int j;
+  
+  std::fill(x.begin(), x.end(), 0.0);
+  drawn.clear();
+  
+  for (double r = s.n_tot - kk; r < s.n_tot; r += 1.0) {
+    t = floor(rng_unif() * (r + 1.0));
+    if (!drawn.insert(t).second) {
+      t = r;
+      drawn.insert(t);
+    }
+    j = std::upper_bound(s.n_cum.begin(), s.n_cum.end(), t) - s.n_cum.begin();
+    x[j] += 1.0;
+  }
+  
+  if (complement) {
+    for (j = 0; j < m; j++)
+      x[j] = n(row, j) - x[j];
+  }
+}
+
+inline void rng_mvhyper_chain(const NumericMatrix& n, int row,
+                              const mvhyper_setup& s, double k,
+                              std::vector<double>& x) {
+  
+  int m = n.ncol();
+  double k_left = k;
+  int j, jj;
+  
+  std::fill(x.begin(), x.end(), 0.0);
+  
+  for (jj = 0; jj < m-1 && k_left > 0.0; jj++) {
+    j = s.order[jj];
+    if (k_left >= n(row, j) + s.n_otr[jj]) {
+      // all the remaining balls are drawn
+      for (; jj < m; jj++)
+        x[s.order[jj]] = n(row, s.order[jj]);
+      return;
+    }
+    x[j] = R::rhyper(n(row, j), s.n_otr[jj], k_left);
+    k_left -= x[j];
+  }
+  
+  if (k_left > 0.0)
+    x[s.order[m-1]] = k_left;
+}
+
+
 // [[Rcpp::export]]
 NumericMatrix cpp_rmvhyper(
     const int& nn,
@@ -135,53 +253,44 @@ NumericMatrix cpp_rmvhyper(
   }
   
   int m = n.ncol();
+  int n_rows = n.nrow();
   NumericMatrix x(nn, m);
-  std::vector<double> n_otr(m);
+  std::vector<double> x_row(m);
+  std::unordered_set<double> drawn;
+  
+  // rows of n are cached only if some of them are going to be reused
+  bool use_cache = nn > n_rows;
+  std::vector<mvhyper_setup> setup(use_cache ? n_rows : 1);
   
-  bool wrong_values;
-  double k_left;
+  double ki;
+  int row;
   
   bool throw_warning = false;
 
   for (int i = 0; i < nn; i++) {
     
-    wrong_values = false;
-    n_otr[0] = 0.0;
+    row = i % n_rows;
+    mvhyper_setup& s = use_cache ? setup[row] : setup[0];
+    if (!use_cache || !s.ready)
+      mvhyper_prepare(n, row, s);
     
-    for (int j = 1; j < m; j++) {
-      if (!isInteger(GETM(n, i, j), false) ||
-          GETM(n, i, j) < 0.0 || ISNAN(GETM(n, i, j))) {
-        wrong_values = true;
-        break;
-      }
-      n_otr[0] += GETM(n, i, j);
-    }
+    ki = GETV(k, i);
     
-    if (wrong_values || ISNAN(GETV(k, i)) || ISNAN(GETM(n, i, 0)) ||
-        !isInteger(GETM(n, i, 0), false) || GETM(n, i, 0) < 0 ||
-        (n_otr[0] + GETM(n, i, 0)) < GETV(k, i) ||
-        !isInteger(GETV(k, i), false) || GETV(k, i) < 0.0) {
+    if (!s.valid || ISNAN(ki) || !isInteger(ki, false) ||
+        ki < 0.0 || ki > s.n_tot) {
       throw_warning = true;
       for (int j = 0; j < m; j++)
         x(i, j) = NA_REAL;
       continue;
     }
     
-    for (int j = 1; j < m; j++)
-      n_otr[j] = n_otr[j-1] - GETM(n, i, j);
-    
-    k_left = GETV(k, i);
-    x(i, 0) = R::rhyper(GETM(n, i, 0), n_otr[0], k_left);
-    k_left -= x(i, 0);
-    
-    if (m > 2) {
-      for (int j = 1; j < m-1; j++) {
-        x(i, j) = R::rhyper(GETM(n, i, j), n_otr[j], k_left);
-        k_left -= x(i, j);
-      }
-    }
+    if (std::min(ki, s.n_tot - ki) <= to_dbl(m))
+      rng_mvhyper_index(n, row, s, ki, x_row, drawn);
+    else
+      rng_mvhyper_chain(n, row, s, ki, x_row);
     
-    x(i, m-1) = k_left;
+    for (int j = 0; j < m; j++)
+      x(i, j) = x_row[j];
     
   }
   
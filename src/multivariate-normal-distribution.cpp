@@ -0,0 +1,280 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using std::sqrt;
+using std::abs;
+using std::exp;
+using std::log;
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+
+
+/*
+*  Multivariate Normal distribution
+*
+*  Values:
+*  x (vector of length d)
+*
+*  Parameters:
+*  mu (vector of length d)
+*  Sigma (positive definite d x d matrix)
+*
+*  Sigma = L L'
+*  z = L^-1 (x - mu)
+*
+*  f(x) = (2*pi)^(-d/2) * det(Sigma)^(-1/2) * exp(-z'z/2)
+*
+*  Sigma may be a d x d x k array of covariance matrices, recycled with
+*  the rows of x and mu. The Cholesky factor and the log-determinant of
+*  each covariance matrix are computed once per call. The rows that share
+*  a covariance matrix are processed in blocks of RNG_BLOCK, with z found
+*  for the whole block by forward substitution column by column (as in
+*  the level 3 BLAS triangular solve), so that the inner loops run over
+*  the rows of the block and each element of L is loaded once per block.
+*
+*/
+
+struct mvnorm_factor {
+  std::vector<double> L;   // lower triangular, stored by columns
+  double half_log_det;     // log(det(Sigma))/2 = sum(log(diag(L)))
+  bool missing;            // some of the elements are NA
+  bool valid;
+};
+
+inline std::vector<mvnorm_factor> mvnorm_factors(const NumericVector& sigma,
+                                                 int d, int k) {
+  std::vector<mvnorm_factor> fac(k);
+  for (int c = 0; c < k; c++) {
+    const double* s = &sigma[c*d*d];
+    mvnorm_factor& f = fac[c];
+    f.missing = false;
+    f.valid = true;
+    f.half_log_det = 0.0;
+    for (int i = 0; i < d; i++) {
+      for (int j = 0; j < d; j++) {
+        if (ISNAN(s[i + j*d]))
+          f.missing = true;
+        else if (abs(s[i + j*d] - s[j + i*d]) > MIN_DIFF_EPS)
+          f.valid = false;
+      }
+    }
+    if (f.missing || !f.valid)
+      continue;
+    f.valid = cholesky(s, d, f.L);
+    if (f.valid) {
+      for (int j = 0; j < d; j++)
+        f.half_log_det += log(f.L[j + j*d]);
+    }
+  }
+  return fac;
+}
+
+// number of the rows i0, i0+k, i0+2*k, ... below N, at most RNG_BLOCK
+inline int mvnorm_block(int i0, int k, int N) {
+  return std::min(RNG_BLOCK, (N - i0 + k - 1) / k);
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dmvnorm(
+    const NumericMatrix& x,
+    const NumericMatrix& mu,
+    const NumericVector& sigma,
+    const bool& log_prob = false
+  ) {
+
+  int d = x.ncol();
+
+  if (d < 1 || mu.ncol() != d)
+    Rcpp::stop("dimensions of x and mean do not match");
+  if (sigma.length() % (d*d) != 0)
+    Rcpp::stop("dimensions of x and sigma do not match");
+
+  int k = sigma.length() / (d*d);
+
+  if (std::min({static_cast<int>(x.nrow()),
+                static_cast<int>(mu.nrow()),
+                k}) < 1) {
+    return NumericVector(0);
+  }
+
+  int Nmax = std::max({
+    static_cast<int>(x.nrow()),
+    static_cast<int>(mu.nrow()),
+    k
+  });
+  NumericVector p(Nmax);
+
+  bool throw_warning = false;
+
+  std::vector<mvnorm_factor> fac = mvnorm_factors(sigma, d, k);
+  std::vector<double> z(RNG_BLOCK * d), q(RNG_BLOCK);
+  double log_const = -to_dbl(d) * log(SQRT_2_PI);
+  double s, nans_sum;
+  bool missing;
+
+  for (int c = 0; c < k; c++) {
+
+    const mvnorm_factor& f = fac[c];
+    const std::vector<double>& L = f.L;
+
+    for (int i0 = c; i0 < Nmax; i0 += k * RNG_BLOCK) {
+
+      int b = mvnorm_block(i0, k, Nmax);
+
+      if (f.missing || !f.valid) {
+        for (int r = 0; r < b; r++)
+          p[i0 + r*k] = f.missing ? NA_REAL : NAN;
+        if (!f.missing)
+          throw_warning = true;
+        continue;
+      }
+
+      for (int j = 0; j < d; j++) {
+        for (int r = 0; r < b; r++) {
+          int i = i0 + r*k;
+          z[j*RNG_BLOCK + r] = GETM(x, i, j) - GETM(mu, i, j);
+        }
+      }
+
+      // z = L^-1 z, column by column for the whole block
+      for (int j = 0; j < d; j++) {
+        double* zj = &z[j*RNG_BLOCK];
+        for (int l = 0; l < j; l++) {
+          s = L[j + l*d];
+          const double* zl = &z[l*RNG_BLOCK];
+          for (int r = 0; r < b; r++)
+            zj[r] -= s * zl[r];
+        }
+        s = 1.0 / L[j + j*d];
+        for (int r = 0; r < b; r++)
+          zj[r] *= s;
+      }
+
+      std::fill(q.begin(), q.begin() + b, 0.0);
+      for (int j = 0; j < d; j++) {
+        const double* zj = &z[j*RNG_BLOCK];
+        for (int r = 0; r < b; r++)
+          q[r] += zj[r] * zj[r];
+      }
+
+      for (int r = 0; r < b; r++) {
+        int i = i0 + r*k;
+        p[i] = log_const - f.half_log_det - 0.5 * q[r];
+        if (R_FINITE(p[i]))
+          continue;
+        // missing values propagate, infinite ones give zero density
+        nans_sum = 0.0;
+        missing = false;
+        for (int j = 0; j < d; j++) {
+          if (ISNAN(GETM(x, i, j)) || ISNAN(GETM(mu, i, j))) {
+            nans_sum += GETM(x, i, j) + GETM(mu, i, j);
+            missing = true;
+          }
+        }
+        p[i] = missing ? nans_sum : R_NegInf;
+      }
+
+    }
+  }
+
+  if (!log_prob)
+    p = Rcpp::exp(p);
+
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericMatrix cpp_rmvnorm(
+    const int& n,
+    const NumericMatrix& mu,
+    const NumericVector& sigma
+  ) {
+
+  int d = mu.ncol();
+
+  if (d < 1 || sigma.length() % (d*d) != 0)
+    Rcpp::stop("dimensions of mean and sigma do not match");
+
+  int k = sigma.length() / (d*d);
+
+  if (std::min({static_cast<int>(mu.nrow()), k}) < 1) {
+    Rcpp::warning("NAs produced");
+    NumericMatrix out(n, d);
+    std::fill(out.begin(), out.end(), NA_REAL);
+    return out;
+  }
+
+  NumericMatrix x(n, d);
+
+  bool throw_warning = false;
+
+  std::vector<mvnorm_factor> fac = mvnorm_factors(sigma, d, std::min(k, n));
+  std::vector<double> e(RNG_BLOCK * d), y(RNG_BLOCK);
+  double s;
+
+  for (int c = 0; c < std::min(k, n); c++) {
+
+    const mvnorm_factor& f = fac[c];
+    const std::vector<double>& L = f.L;
+
+    for (int i0 = c; i0 < n; i0 += k * RNG_BLOCK) {
+
+      int b = mvnorm_block(i0, k, n);
+
+      if (f.missing || !f.valid) {
+        throw_warning = true;
+        for (int j = 0; j < d; j++) {
+          for (int r = 0; r < b; r++)
+            x(i0 + r*k, j) = NA_REAL;
+        }
+        continue;
+      }
+
+      for (int r = 0; r < b; r++) {
+        for (int j = 0; j < d; j++)
+          e[j*RNG_BLOCK + r] = R::norm_rand();
+      }
+
+      // x = mu + L e, column by column for the whole block
+      for (int j = 0; j < d; j++) {
+        std::fill(y.begin(), y.begin() + b, 0.0);
+        for (int l = 0; l <= j; l++) {
+          s = L[j + l*d];
+          const double* el = &e[l*RNG_BLOCK];
+          for (int r = 0; r < b; r++)
+            y[r] += s * el[r];
+        }
+        for (int r = 0; r < b; r++) {
+          int i = i0 + r*k;
+          x(i, j) = GETM(mu, i, j) + y[r];
+        }
+      }
+
+      for (int r = 0; r < b; r++) {
+        int i = i0 + r*k;
+        for (int j = 0; j < d; j++) {
+          if (ISNAN(x(i, j))) {
+            throw_warning = true;
+            for (int l = 0; l < d; l++)
+              x(i, l) = NA_REAL;
+            break;
+          }
+        }
+      }
+
+    }
+  }
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
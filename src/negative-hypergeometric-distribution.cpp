@@ -13,41 +13,29 @@ using std::ceil;
 using Rcpp::NumericVector;
 
 
-std::vector<double> nhyper_table(
-    double n, double m, double r,
-    bool cumulative = false
-  ) {
-  
-  if (n < 0.0 || m < 0.0 || r < 0.0 || r > m)
-    Rcpp::stop("inadmissible values");
-  
-  double j, N, start_eps;
-  int ni = to_pos_int(n);
-  N = m+n;
-  
-  std::vector<double> t(ni), h(ni), p(ni+1);
-  start_eps = 1e-200;
-  h[0] = start_eps * r*n/(N-r);
-  t[0] = start_eps + h[0];
+// probabilities of x - r = 0, 1, ..., n, the ratio of the consecutive
+// probabilities is (j+r)(n-j) / ((m+n-j-r)(j+1)), so the pmf is log-concave;
+// false if the table would be larger than max_size
+//
+// x - r follows the beta-binomial distribution with size n, alpha = r and
+// beta = m - r + 1, what is used when the table is too large
 
-  for (int i = 1; i <= ni-1; i++) {
-    j = to_dbl(i) + r;
-    h[i] = h[i-1] * j*(n+r-j)/(N-j)/(j+1.0-r);
-    t[i] = t[i-1] + h[i];
-  }
+bool nhyper_table(double n, double m, double r, double max_size,
+                  pmf_table& tab) {
   
-  p[0] = start_eps / t[ni-1];
+  // the caller needs to assure that the parameters are admissible
+  // and the size of the table is within the integer range
   
-  if (cumulative) {
-    for (int i = 1; i < ni; i++)
-      p[i] = t[i-1] / t[ni-1];
-    p[ni] = 1.0;
-  } else {
-    for (int i = 1; i <= ni; i++)
-      p[i] = h[i-1] / t[ni-1];
-  }
+  double N = m+n;
   
-  return p;
+  return make_mode_table([=](double j) {
+    return (j+r) * (n-j) / ((N-j-r) * (j+1.0));
+  }, 0.0, n, max_size, tab);
+}
+
+inline double logpmf_nhyper_bbinom(double k, double n, double m, double r) {
+  return R::lchoose(n, k) + R::lbeta(k + r, n - k + m - r + 1.0) -
+    R::lbeta(r, m - r + 1.0);
 }
 
 
@@ -75,9 +63,14 @@ NumericVector cpp_dnhyper(
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, pmf_table> memo;
+  std::map<std::tuple<int, int, int>, pmf_table>::iterator it;
+  std::tuple<int, int, int> key;
+  double max_size = (approx_tolerance() > 0.0) ? to_dbl(TABLE_MAX_SIZE) : R_PosInf;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
     
@@ -101,19 +94,30 @@ NumericVector cpp_dnhyper(
       p[i] = 0.0;
     } else if (is_large_int(GETV(x, i))) {
       p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      note_int_coercion();
+    } else if (is_large_int(GETV(n, i))) {
+      p[i] = NA_REAL;
+      note_int_coercion();
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      key = std::make_tuple(
         static_cast<int>(i % n.length()),
         static_cast<int>(i % m.length()),
         static_cast<int>(i % r.length())
-      )];
+      );
+      it = memo.find(key);
       
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), false);
+      if (it == memo.end()) {
+        pmf_table tab;
+        nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), max_size, tab);
+        it = memo.insert(std::make_pair(key, tab)).first;
       }
-      p[i] = tmp[to_pos_int( GETV(x, i) - GETV(r, i) )];
+      
+      if (it->second.pmf.size())
+        p[i] = table_pmf(it->second, GETV(x, i) - GETV(r, i));
+      else
+        p[i] = exp(logpmf_nhyper_bbinom(GETV(x, i) - GETV(r, i), GETV(n, i),
+                                        GETV(m, i), GETV(r, i)));
       
     }
   } 
@@ -121,6 +125,7 @@ NumericVector cpp_dnhyper(
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -153,9 +158,15 @@ NumericVector cpp_pnhyper(
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, pmf_table> memo;
+  std::map<std::tuple<int, int, int>, pmf_table>::iterator it;
+  std::tuple<int, int, int> key;
+  double tol = approx_tolerance();
+  double max_size = (tol > 0.0) ? to_dbl(TABLE_MAX_SIZE) : R_PosInf;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
     
@@ -180,19 +191,32 @@ NumericVector cpp_pnhyper(
       p[i] = 1.0;
     } else if (is_large_int(GETV(x, i))) {
       p[i] = NA_REAL;
-      Rcpp::warning("NAs introduced by coercion to integer range");
+      note_int_coercion();
+    } else if (is_large_int(GETV(n, i))) {
+      p[i] = NA_REAL;
+      note_int_coercion();
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      key = std::make_tuple(
         static_cast<int>(i % n.length()),
         static_cast<int>(i % m.length()),
         static_cast<int>(i % r.length())
-      )];
+      );
+      it = memo.find(key);
+      
+      if (it == memo.end()) {
+        pmf_table tab;
+        nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), max_size, tab);
+        it = memo.insert(std::make_pair(key, tab)).first;
+      }
       
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
+      if (it->second.pmf.size()) {
+        p[i] = table_cdf(it->second, GETV(x, i) - GETV(r, i));
+      } else {
+        p[i] = cdf_bbinom_approx(GETV(x, i) - GETV(r, i), GETV(n, i), GETV(r, i),
+                                 GETV(m, i) - GETV(r, i) + 1.0, tol);
+        note_approximation();
       }
-      p[i] = tmp[to_pos_int( GETV(x, i) - GETV(r, i) )];
       
     }
   } 
@@ -203,6 +227,7 @@ NumericVector cpp_pnhyper(
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -242,9 +267,11 @@ NumericVector cpp_qnhyper(
   if (!lower_tail)
     pp = 1.0 - pp;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, pmf_table> memo;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
     
@@ -264,28 +291,30 @@ NumericVector cpp_qnhyper(
                !isInteger(GETV(r, i), false)) {
       throw_warning = true;
       x[i] = NAN;
+    } else if (is_large_int(GETV(n, i))) {
+      x[i] = NA_REAL;
+      note_int_coercion();
     } else {
       
-      std::vector<double>& tmp = memo[std::make_tuple(
+      pmf_table& tmp = memo[std::make_tuple(
         static_cast<int>(i % n.length()),
         static_cast<int>(i % m.length()),
         static_cast<int>(i % r.length())
       )];
       
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
+      if (!tmp.pmf.size()) {
+        nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), R_PosInf, tmp);
       }
       
-      for (int j = 0; j <= to_pos_int( GETV(n, i) ); j++) {
-        if (tmp[j] >= GETV(pp, i)) {
-          x[i] = to_dbl(j) + GETV(r, i);
-          break;
-        }
-      }
+      if (GETV(pp, i) == 0.0)
+        x[i] = GETV(r, i);
+      else
+        x[i] = table_quantile(tmp, GETV(pp, i)) + GETV(r, i);
       
     }
   } 
   
+  report_diagnostics(x);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -311,9 +340,11 @@ NumericVector cpp_rnhyper(
   
   bool throw_warning = false;
   
-  std::map<std::tuple<int, int, int>, std::vector<double>> memo;
+  std::map<std::tuple<int, int, int>, pmf_table> memo;
   
+  diagnostics& diag = reset_diagnostics();
   for (int i = 0; i < nn; i++) {
+    diag.index = i;
     if (i % 100 == 0)
       Rcpp::checkUserInterrupt();
     
@@ -323,30 +354,29 @@ NumericVector cpp_rnhyper(
         !isInteger(GETV(m, i), false) || !isInteger(GETV(r, i), false)) {
       throw_warning = true;
       x[i] = NA_REAL;
+    } else if (is_large_int(GETV(n, i))) {
+      x[i] = NA_REAL;
+      note_int_coercion();
     } else {
 
-      std::vector<double>& tmp = memo[std::make_tuple(
+      pmf_table& tmp = memo[std::make_tuple(
         static_cast<int>(i % n.length()),
         static_cast<int>(i % m.length()),
         static_cast<int>(i % r.length())
       )];
       
-      if (!tmp.size()) {
-        tmp = nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), true);
+      if (!tmp.pmf.size()) {
+        nhyper_table(GETV(n, i), GETV(m, i), GETV(r, i), R_PosInf, tmp);
+        make_guide_table(tmp.cum);
       }
       
       u = rng_unif();
-      
-      for (int j = 0; j <= to_pos_int( GETV(n, i) ); j++) {
-        if (tmp[j] >= u) {
-          x[i] = to_dbl(j) + GETV(r, i);
-          break;
-        }
-      }
+      x[i] = tmp.first + to_dbl(rng_table(u, tmp.cum)) + GETV(r, i);
       
     }
   } 
   
+  report_diagnostics(x);
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
@@ -33,7 +33,7 @@ double pdf_nsbeta(double x, double alpha, double beta, double l,
     return x+alpha+beta+l+u;
 #endif
   if (l >= u || alpha < 0.0 || beta < 0.0) {
-    Rcpp::warning("NaNs produced");
+    throw_warning = true;
     return NAN;
   }
   double r = u-l;
@@ -51,7 +51,7 @@ double cdf_nsbeta(double x, double alpha, double beta, double l,
     return x+alpha+beta+l+u;
 #endif
   if (l >= u || alpha < 0.0 || beta < 0.0) {
-    Rcpp::warning("NaNs produced");
+    throw_warning = true;
     return NAN;
   }
   return R::pbeta((x-l)/(u-l), alpha, beta, lower_tail, log_p);
@@ -64,7 +64,7 @@ double invcdf_nsbeta(double p, double alpha, double beta, double l,
     return p+alpha+beta+l+u;
 #endif
   if (l >= u || alpha < 0.0 || beta < 0.0 || !VALID_PROB(p)) {
-    Rcpp::warning("NaNs produced");
+    throw_warning = true;
     return NAN;
   }
   return R::qbeta(p, alpha, beta, true, false) * (u-l) + l;
@@ -74,7 +74,7 @@ double rng_nsbeta(double alpha, double beta, double l, double u,
                   bool& throw_warning) {
   if (ISNAN(alpha) || ISNAN(beta) || ISNAN(l) || ISNAN(u) ||
       l >= u || alpha < 0.0 || beta < 0.0) {
-    Rcpp::warning("NAs produced");
+    throw_warning = true;
     return NA_REAL;
   }
   return R::rbeta(alpha, beta) * (u-l) + l;
@@ -59,6 +59,45 @@ inline double cdf_pareto(double x, double a, double b,
   return 1.0 - pow(b/x, a);
 }
 
+inline double logcens_pareto(double x, double status, double a, double b,
+                             bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(a) || ISNAN(b))
+    return x+status+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // S(x) = (b/x)^a
+  double log_S = (x < b) ? 0.0 : log(b/x) * a;
+  return censored_loglik(status, [&]() {
+    return logpdf_pareto(x, a, b, throw_warning);
+  }, [&]() {
+    return log_S;
+  }, [&]() {
+    return log1mexp(log_S);
+  }, throw_warning);
+}
+
+inline double hazard_pareto(double x, double a, double b, bool cumulative,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(a) || ISNAN(b))
+    return x+a+b;
+#endif
+  if (a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // h(x) = a/x, H(x) = a * log(x/b)
+  if (x < b)
+    return cumulative ? 0.0 : R_NegInf;
+  if (cumulative)
+    return a * log(x/b);
+  return log(a) - log(x);
+}
+
 inline double invcdf_pareto(double p, double a, double b,
                             bool& throw_warning) {
 #ifdef IEEE_754
@@ -81,6 +120,50 @@ inline double rng_pareto(double a, double b, bool& throw_warning) {
   return b / pow(u, 1.0/a);
 }
 
+inline double invcdf_logq_pareto(double log_q, double a, double b) {
+  return b * exp(-log_q / a);
+}
+
+inline double invcdf_pq_pareto(double p, double q, double a, double b) {
+  return invcdf_logq_pareto(log_upper(p, q), a, b);
+}
+
+inline double rng_extreme_pareto(double size, double a, double b,
+                                 bool minimum, bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(a) || ISNAN(b) ||
+      size <= 0.0 || a <= 0.0 || b <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_pareto(p, q, a, b);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_pareto = {
+  "pareto", 2, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0 && t[1] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_pareto(x, t[0], t[1], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    return logcens_pareto(x, lower_tail ? CENS_LEFT : CENS_RIGHT,
+                          t[0], t[1], tw);
+  },
+  [](double, double log_q, const double* t) -> double {
+    return invcdf_logq_pareto(log_q, t[0], t[1]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_pareto(t[0], t[1], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dpareto(
@@ -200,7 +283,8 @@ NumericVector cpp_qpareto(
 NumericVector cpp_rpareto(
     const int& n,
     const NumericVector& a,
-    const NumericVector& b
+    const NumericVector& b,
+    const bool& sorted = false
   ) {
   
   if (std::min({a.length(), b.length()}) < 1) {
@@ -212,13 +296,131 @@ NumericVector cpp_rpareto(
   
   bool throw_warning = false;
 
+  if (sorted && a.length() == 1 && b.length() == 1) {
+    if (ISNAN(a[0]) || ISNAN(b[0]) || a[0] <= 0.0 || b[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_pareto(p, q, a[0], b[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_pareto(GETV(a, i), GETV(b, i),
                       throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_pareto(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& a,
+    const NumericVector& b,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), a.length(), b.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_pareto(GETV(size, i), GETV(a, i), GETV(b, i), minimum,
+                              throw_warning);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_pareto(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& a,
+    const NumericVector& b,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(), a.length(), b.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    a.length(),
+    b.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_pareto(GETV(x, i), GETV(status, i), GETV(a, i), GETV(b, i),
+                          throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_pareto(
+    const NumericVector& x,
+    const NumericVector& a,
+    const NumericVector& b,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), a.length(), b.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    a.length(),
+    b.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_pareto(GETV(x, i), GETV(a, i), GETV(b, i), cumulative,
+                         throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
@@ -88,6 +88,25 @@ inline double rng_power(double alpha, double beta,
   return alpha * pow(u, 1.0/beta);
 }
 
+// inverted in the smaller tail, p = 1 - q is rounded near one
+inline double invcdf_pq_power(double p, double q, double alpha, double beta) {
+  if (q < p)
+    return alpha * exp(log1p(-q)/beta);
+  return alpha * pow(p, 1.0/beta);
+}
+
+inline double rng_extreme_power(double size, double alpha, double beta,
+                                bool minimum, bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(alpha) || ISNAN(beta) ||
+      size <= 0.0 || alpha <= 0.0 || beta <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_power(p, q, alpha, beta);
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dpower(
@@ -207,7 +226,8 @@ NumericVector cpp_qpower(
 NumericVector cpp_rpower(
     const int& n,
     const NumericVector& alpha,
-    const NumericVector& beta
+    const NumericVector& beta,
+    const bool& sorted = false
   ) {
   
   if (std::min({alpha.length(), beta.length()}) < 1) {
@@ -219,10 +239,54 @@ NumericVector cpp_rpower(
   
   bool throw_warning = false;
 
+  if (sorted && alpha.length() == 1 && beta.length() == 1) {
+    if (ISNAN(alpha[0]) || ISNAN(beta[0]) ||
+        alpha[0] <= 0.0 || beta[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_power(p, q, alpha[0], beta[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_power(GETV(alpha, i), GETV(beta, i),
                      throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_power(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& alpha,
+    const NumericVector& beta,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), alpha.length(), beta.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_power(GETV(size, i), GETV(alpha, i), GETV(beta, i),
+                             minimum, throw_warning);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
@@ -0,0 +1,156 @@
+#include <Rcpp.h>
+#include "shared.h"
+// [[Rcpp::interfaces(r, cpp)]]
+// [[Rcpp::plugins(cpp11)]]
+
+using std::exp;
+using std::floor;
+using Rcpp::NumericVector;
+using Rcpp::NumericMatrix;
+using Rcpp::IntegerVector;
+
+
+/*
+ * Approximations of quantile functions for frozen parameter sets
+ *
+ * The tables are built once in R (see qapprox) by evaluating the exact
+ * quantile function. Here they are only evaluated. Probabilities outside
+ * of the central region [lo, hi] covered by the table are returned as NA,
+ * so that they can be computed by the exact quantile function.
+ *
+ * Continuous case: piecewise Chebyshev interpolants, interval j covers
+ * [breaks[j], breaks[j+1]] and its coefficients are in coefs(_, j).
+ *
+ * Discrete case: cdf[k] is the probability P(X <= x0 + k), the quantile
+ * is x0 plus the number of cdf values smaller than p.
+ *
+ * In both cases the guide table splits [lo, hi] into equal cells and
+ * guide[g] is the first interval (or cdf value) that needs to be checked
+ * for probabilities falling into the g-th cell, so that the search takes
+ * constant expected time.
+ *
+ */
+
+inline double lower_prob(double p, bool lower_tail, bool log_prob) {
+  if (log_prob)
+    p = exp(p);
+  if (!lower_tail)
+    p = 1.0 - p;
+  return p;
+}
+
+inline double chebyshev_eval(const double* c, int n, double t) {
+  // Clenshaw recurrence
+  double b1 = 0.0, b2 = 0.0, tmp;
+  double t2 = 2.0 * t;
+  for (int j = n - 1; j >= 1; j--) {
+    tmp = t2 * b1 - b2 + c[j];
+    b2 = b1;
+    b1 = tmp;
+  }
+  return t * b1 - b2 + c[0];
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qapprox_cheb(
+    const NumericVector& p,
+    const NumericVector& breaks,
+    const NumericMatrix& coefs,
+    const IntegerVector& guide,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+
+  int Nmax = p.length();
+  int m = coefs.ncol();
+  int n = coefs.nrow();
+  int G = guide.length();
+  NumericVector x(Nmax);
+
+  if (Nmax < 1)
+    return NumericVector(0);
+
+  double lo = breaks[0];
+  double hi = breaks[m];
+  double scale = to_dbl(G) / (hi - lo);
+  const double* c = &coefs[0];
+
+  double pp, a, b;
+  int g, j;
+
+  for (int i = 0; i < Nmax; i++) {
+
+    pp = lower_prob(p[i], lower_tail, log_prob);
+
+    // NaN's and the tails are left to the exact quantile function
+    if (!(pp >= lo && pp <= hi)) {
+      x[i] = NA_REAL;
+      continue;
+    }
+
+    g = static_cast<int>(floor((pp - lo) * scale));
+    j = guide[g < G ? g : G - 1];
+    while (j > 0 && pp < breaks[j])
+      j--;
+    while (j < m - 1 && pp > breaks[j + 1])
+      j++;
+
+    a = breaks[j];
+    b = breaks[j + 1];
+    x[i] = chebyshev_eval(c + j * n, n, (2.0 * pp - a - b) / (b - a));
+
+  }
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_qapprox_disc(
+    const NumericVector& p,
+    const NumericVector& cdf,
+    const double& x0,
+    const double& lo,
+    const double& hi,
+    const IntegerVector& guide,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+
+  int Nmax = p.length();
+  int K = cdf.length();
+  int G = guide.length();
+  NumericVector x(Nmax);
+
+  if (Nmax < 1)
+    return NumericVector(0);
+
+  double scale = to_dbl(G) / (hi - lo);
+
+  double pp;
+  int g, j;
+
+  for (int i = 0; i < Nmax; i++) {
+
+    pp = lower_prob(p[i], lower_tail, log_prob);
+
+    if (!(pp >= lo && pp <= hi)) {
+      x[i] = NA_REAL;
+      continue;
+    }
+
+    g = static_cast<int>(floor((pp - lo) * scale));
+    j = guide[g < G ? g : G - 1];
+    while (j > 0 && cdf[j - 1] >= pp)
+      j--;
+    while (j < K && cdf[j] < pp)
+      j++;
+
+    x[i] = x0 + to_dbl(j);
+
+  }
+
+  return x;
+}
+
@@ -64,6 +64,27 @@ inline double cdf_rayleigh(double x, double sigma,
   return 1.0 - exp(-(x*x) / (2.0*(sigma*sigma)));
 }
 
+inline double logcens_rayleigh(double x, double status, double sigma,
+                               bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(sigma))
+    return x+status+sigma;
+#endif
+  if (sigma <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // S(x) = exp(-x^2/(2*sigma^2))
+  double log_S = (x < 0.0) ? 0.0 : -(x*x) / (2.0*(sigma*sigma));
+  return censored_loglik(status, [&]() {
+    return logpdf_rayleigh(x, sigma, throw_warning);
+  }, [&]() {
+    return log_S;
+  }, [&]() {
+    return log1mexp(log_S);
+  }, throw_warning);
+}
+
 inline double invcdf_rayleigh(double p, double sigma,
                               bool& throw_warning) {
 #ifdef IEEE_754
@@ -86,6 +107,49 @@ inline double rng_rayleigh(double sigma, bool& throw_warning) {
   return sqrt(-2.0*(sigma*sigma) * log(u));
 }
 
+inline double invcdf_logq_rayleigh(double log_q, double sigma) {
+  return sqrt(-2.0*(sigma*sigma) * log_q);
+}
+
+inline double invcdf_pq_rayleigh(double p, double q, double sigma) {
+  return invcdf_logq_rayleigh(log_upper(p, q), sigma);
+}
+
+inline double rng_extreme_rayleigh(double size, double sigma, bool minimum,
+                                   bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(sigma) || sigma <= 0.0 || size <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_rayleigh(p, q, sigma);
+}
+
+// component of the generic finite mixtures, see finite-mixture.cpp
+extern const mix_family mix_rayleigh = {
+  "rayleigh", 1, false,
+  [](const double* t) -> bool {
+    return t[0] > 0.0;
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_rayleigh(x, t[0], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    return logcens_rayleigh(x, lower_tail ? CENS_LEFT : CENS_RIGHT,
+                            t[0], tw);
+  },
+  [](double, double log_q, const double* t) -> double {
+    return invcdf_logq_rayleigh(log_q, t[0]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_rayleigh(t[0], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_drayleigh(
@@ -198,7 +262,8 @@ NumericVector cpp_qrayleigh(
 // [[Rcpp::export]]
 NumericVector cpp_rrayleigh(
     const int& n,
-    const NumericVector& sigma
+    const NumericVector& sigma,
+    const bool& sorted = false
   ) {
   
   if (sigma.length() < 1) {
@@ -210,12 +275,88 @@ NumericVector cpp_rrayleigh(
   
   bool throw_warning = false;
 
+  if (sorted && sigma.length() == 1) {
+    if (ISNAN(sigma[0]) || sigma[0] <= 0.0) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_rayleigh(p, q, sigma[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_rayleigh(GETV(sigma, i), throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
 
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_rayleigh(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& sigma,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), sigma.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_rayleigh(GETV(size, i), GETV(sigma, i), minimum,
+                                throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_rayleigh(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& sigma,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(), sigma.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    sigma.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_rayleigh(GETV(x, i), GETV(status, i), GETV(sigma, i),
+                            throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
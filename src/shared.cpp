@@ -1,15 +1,128 @@
 #include <Rcpp.h>
 #include "shared.h"
 
+static thread_local diagnostics diag = {0, {0}, {0.0}, {{0}}};
+
+static const char* diag_names[DIAG_KINDS] = {
+  "non-integer", "improper", "integer coercion", "approximation",
+  "no convergence"
+};
+
+diagnostics& kernel_diagnostics() {
+  return diag;
+}
+
+void clear_diagnostics() {
+  diag = {0, {0}, {0.0}, {{0}}};
+}
+
+diagnostics& reset_diagnostics() {
+  clear_diagnostics();
+  return diag;
+}
+
+void note_diagnostic(diag_kind kind, double x) {
+  int k = diag.count[kind]++;
+  if (k == 0)
+    diag.first_x[kind] = x;
+  if (k < DIAG_MAX_INDEX)
+    diag.first_index[kind][k] = diag.index;
+}
+
+void report_diagnostics(Rcpp::NumericVector& res) {
+  
+  diagnostics d = diag;
+  clear_diagnostics();
+  
+  int kinds = 0;
+  for (int k = 0; k < DIAG_KINDS; k++) {
+    if (d.count[k] > 0)
+      kinds++;
+  }
+  if (kinds == 0)
+    return;
+  
+  char msg[100];
+  
+  if (d.count[DIAG_NON_INTEGER] == 1) {
+    std::snprintf(msg, sizeof(msg), "non-integer: %f",
+                  d.first_x[DIAG_NON_INTEGER]);
+    Rcpp::warning(msg);
+  } else if (d.count[DIAG_NON_INTEGER] > 1) {
+    std::snprintf(msg, sizeof(msg), "non-integer: %f (%d non-integer values in total)",
+                  d.first_x[DIAG_NON_INTEGER], d.count[DIAG_NON_INTEGER]);
+    Rcpp::warning(msg);
+  }
+  
+  if (d.count[DIAG_IMPROPER] == 1) {
+    std::snprintf(msg, sizeof(msg), "improper x = %f",
+                  d.first_x[DIAG_IMPROPER]);
+    Rcpp::warning(msg);
+  } else if (d.count[DIAG_IMPROPER] > 1) {
+    std::snprintf(msg, sizeof(msg), "improper x = %f (%d improper values in total)",
+                  d.first_x[DIAG_IMPROPER], d.count[DIAG_IMPROPER]);
+    Rcpp::warning(msg);
+  }
+  
+  if (d.count[DIAG_INT_COERCION] == 1) {
+    Rcpp::warning("NAs introduced by coercion to integer range");
+  } else if (d.count[DIAG_INT_COERCION] > 1) {
+    std::snprintf(msg, sizeof(msg), "NAs introduced by coercion to integer range (%d values)",
+                  d.count[DIAG_INT_COERCION]);
+    Rcpp::warning(msg);
+  }
+  
+  if (d.count[DIAG_NO_CONVERGENCE] == 1) {
+    std::snprintf(msg, sizeof(msg), "approximation did not converge for x = %f",
+                  d.first_x[DIAG_NO_CONVERGENCE]);
+    Rcpp::warning(msg);
+  } else if (d.count[DIAG_NO_CONVERGENCE] > 1) {
+    std::snprintf(msg, sizeof(msg), "approximation did not converge for x = %f (%d values in total)",
+                  d.first_x[DIAG_NO_CONVERGENCE], d.count[DIAG_NO_CONVERGENCE]);
+    Rcpp::warning(msg);
+  }
+  
+  SEXP opt = Rf_GetOption1(Rf_install("extraDistr.diagnostics"));
+  if (Rf_asLogical(opt) != TRUE)
+    return;
+  
+  Rcpp::List out(kinds);
+  Rcpp::CharacterVector nms(kinds);
+  int j = 0;
+  for (int k = 0; k < DIAG_KINDS; k++) {
+    if (d.count[k] == 0)
+      continue;
+    int m = std::min(d.count[k], DIAG_MAX_INDEX);
+    Rcpp::IntegerVector idx(m);
+    for (int l = 0; l < m; l++)
+      idx[l] = d.first_index[k][l] + 1;
+    out[j] = Rcpp::List::create(
+      Rcpp::Named("count") = d.count[k],
+      Rcpp::Named("index") = idx
+    );
+    nms[j] = diag_names[k];
+    j++;
+  }
+  out.attr("names") = nms;
+  res.attr("diagnostics") = out;
+}
+
+double approx_tolerance() {
+  SEXP opt = Rf_GetOption1(Rf_install("extraDistr.approx.tol"));
+  if (Rf_isNull(opt))
+    return APPROX_TOL;
+  double tol = Rf_asReal(opt);
+  if (ISNAN(tol) || tol < 0.0)
+    Rcpp::stop("extraDistr.approx.tol option needs to be a non-negative number");
+  return tol;
+}
+
 bool isInteger(double x, bool warn) {
   if (ISNAN(x))
     return false;
   if (((x < 0.0) ? std::ceil(x) : std::floor(x)) != x) {
-    if (warn) {
-      char msg[55];
-      std::snprintf(msg, sizeof(msg), "non-integer: %f", x);
-      Rcpp::warning(msg);
-    }
+    if (warn)
+      note_non_integer(x);
     return false;
   }
   return true;
@@ -44,3 +157,39 @@ double rng_unif() {
   return u;
 }
 
+
+void make_guide_table(cdf_table& tab) {
+  int K = tab.cdf.size();
+  int G = K;
+  tab.guide.resize(G);
+  int j = 0;
+  for (int g = 0; g < G; g++) {
+    while (j < K - 1 && tab.cdf[j] < to_dbl(g) / to_dbl(G))
+      j++;
+    tab.guide[g] = j;
+  }
+}
+
+
+
+// lower triangular Cholesky factor L of the symmetric d x d matrix
+// x = L L', both stored by columns; false if x is not positive definite
+bool cholesky(const double* x, int d, std::vector<double>& L) {
+  double s;
+  L.assign(d * d, 0.0);
+  for (int j = 0; j < d; j++) {
+    s = x[j + j*d];
+    for (int k = 0; k < j; k++)
+      s -= L[j + k*d] * L[j + k*d];
+    if (!(s > 0.0))
+      return false;
+    L[j + j*d] = std::sqrt(s);
+    for (int i = j+1; i < d; i++) {
+      s = x[i + j*d];
+      for (int k = 0; k < j; k++)
+        s -= L[i + k*d] * L[j + k*d];
+      L[i + j*d] = s / L[j + j*d];
+    }
+  }
+  return true;
+}
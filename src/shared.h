@@ -4,6 +4,9 @@
 
 #define STRICT_R_HEADERS
 #include <Rcpp.h>
+#include <algorithm>
+#include <array>
+#include <unordered_map>
 
 // Constants
 
@@ -13,17 +16,147 @@ static const double LOG_2F       = 0.6931471805599452862268; // log(2)
 
 static const double MIN_DIFF_EPS = 1e-8;
 
+static const int INVCDF_MAXIT    = 100;  // iteration bound for invcdf_newton
+static const int TABLE_DRAWS     = 4;    // table sampling pays off if size <= TABLE_DRAWS * draws
+static const double TABLE_TOL    = 1e-300; // tail mass neglected by make_mode_table
+static const int TABLE_MAX_SIZE  = 1000000; // larger tables are replaced by approximations
+static const double APPROX_TOL   = 1e-10;  // default extraDistr.approx.tol option
+static const int CENS_RIGHT      = 0;    // censoring status codes, see censored_loglik
+static const int CENS_EVENT      = 1;
+static const int CENS_LEFT       = 2;
+static const int DEDUP_MIN       = 1024; // shorter inputs are evaluated without value_cache
+static const int DEDUP_PROBE     = 4096; // lookups after which value_cache checks its hit rate
+static const int DEDUP_MAX_SIZE  = 1000000; // maximal number of values cached
+static const int RNG_BLOCK       = 256;  // rows drawn at once by the multivariate samplers
+
 // MACROS
 
 #define GETV(x, i)      x[i % x.length()]    // wrapped indexing of vector
 #define GETM(x, i, j)   x(i % x.nrow(), j)   // wrapped indexing of matrix
 #define VALID_PROB(p)   ((p >= 0.0) && (p <= 1.0))
 
+// Diagnostics
+//
+// Kernels (pdf_*, cdf_*, invcdf_* functions and probability tables) do not
+// call R API, so that they can be used outside of the main R thread. Invalid
+// parameters are signalled by the throw_warning flag and other problems are
+// recorded in the per-thread diagnostics record: for each kind of problem
+// number of cases, the first offending value and indexes of the first
+// DIAG_MAX_INDEX elements where it happened (exports obtain the record by
+// reset_diagnostics() and set the index of the current element). Exports
+// raise one summarized warning per kind, after the loop, by calling
+// report_diagnostics(); use of approximations is not warned about. If the
+// extraDistr.diagnostics option is TRUE, the record is also attached to
+// the result as the "diagnostics" attribute.
+
+enum diag_kind {
+  DIAG_NON_INTEGER = 0,   // non-integer value of discrete variable
+  DIAG_IMPROPER,          // value outside of the support
+  DIAG_INT_COERCION,      // value outside of the integer range
+  DIAG_APPROXIMATION,     // approximation used instead of exact computation
+  DIAG_NO_CONVERGENCE,    // iterations stopped before reaching the tolerance
+  DIAG_KINDS
+};
+
+static const int DIAG_MAX_INDEX  = 5;
+
+struct diagnostics {
+  int index;                                    // current element
+  int count[DIAG_KINDS];
+  double first_x[DIAG_KINDS];
+  int first_index[DIAG_KINDS][DIAG_MAX_INDEX];
+};
+
+diagnostics& kernel_diagnostics();
+void clear_diagnostics();
+diagnostics& reset_diagnostics();           // clears and returns the record
+void report_diagnostics(Rcpp::NumericVector& res);   // main R thread only
+void note_diagnostic(diag_kind kind, double x);
+inline void note_non_integer(double x);
+inline void note_improper(double x);
+inline void note_int_coercion();
+inline void note_approximation();
+inline void note_no_convergence(double x);
+double approx_tolerance();                   // main R thread only
+
+// Cumulative probability tables for sampling by inversion: cdf[j] is
+// P(X <= j) and guide[g] is the first j such that cdf[j] >= g/G, where
+// G is the size of the guide table, so the search takes constant expected
+// time (see Devroye, 1986, sec. III.2.4). Empty cdf marks parameter sets
+// that are sampled by other methods.
+
+struct cdf_table {
+  std::vector<double> cdf;
+  std::vector<int> guide;
+};
+
+// Mode-centred tables of a log-concave pmf (see make_mode_table), the
+// probabilities of the values outside of the table are below TABLE_TOL.
+
+struct pmf_table {
+  double first;               // pmf[j] = P(X = first + j)
+  std::vector<double> pmf;
+  cdf_table cum;              // cum.cdf[j] = P(X <= first + j)
+};
+
+// Results of a kernel cached by the values of its arguments, so that
+// repeated (x, parameters) tuples, common for count data, are evaluated
+// once (see cached_eval). The cache switches itself off if less than half
+// of the first DEDUP_PROBE lookups were hits. Only the values whose
+// evaluation does not record diagnostics may be cached.
+
+template <int N>
+struct value_hash {
+  std::size_t operator()(const std::array<double, N>& key) const {
+    std::size_t h = 0;
+    for (int j = 0; j < N; j++)
+      h ^= std::hash<double>()(key[j]) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+  }
+};
+
+template <int N>
+struct value_cache {
+  std::unordered_map<std::array<double, N>, double, value_hash<N>> values;
+  bool active;
+  int lookups;
+  int hits;
+  explicit value_cache(int n) : active(n >= DEDUP_MIN), lookups(0), hits(0) {}
+};
+
+// Component families of the generic finite mixtures (see finite-mixture.cpp)
+// and margins of the copulas (see copula.cpp), defined next to the kernels
+// of each family and looked up by find_mix_family(). theta points to npar
+// parameters that are not NaN; the other functions may be called only
+// if valid(theta) is true. log_cdf is the log-probability of the lower,
+// or of the upper tail, and quantile takes the logs of complementary
+// probabilities p + q = 1, as the invcdf_logp_* and invcdf_logq_*
+// functions do, so that it is precise also when p, or q underflows.
+// Discrete families are used only as the margins of the copulas.
+
+static const int MIX_MAX_PAR     = 4;    // maximal number of parameters of a component
+
+struct mix_family {
+  const char* name;
+  int npar;
+  bool discrete;
+  bool (*valid)(const double* theta);
+  double (*log_pdf)(double x, const double* theta);
+  double (*log_cdf)(double x, const double* theta, bool lower_tail);
+  double (*quantile)(double log_p, double log_q, const double* theta);
+  double (*rng)(const double* theta);
+};
+
 // functions
 
 bool isInteger(double x, bool warn = true);
 double finite_max_int(const Rcpp::NumericVector& x);
 double rng_unif();         // standard uniform
+void make_guide_table(cdf_table& tab);
+const mix_family* find_mix_family(const std::string& name);  // NULL if unknown
+bool cholesky(const double* x, int d, std::vector<double>& L);
+double cdf_bbinom_approx(double x, double n, double alpha,
+                         double beta, double tol);
 
 // inline functions
 
@@ -35,10 +168,44 @@ inline double InvPhi(double x);
 inline double factorial(double x);
 inline double lfactorial(double x);
 inline double rng_sign();
+inline int rng_table(double u, const cdf_table& tab);
 inline bool is_large_int(double x); 
 inline double to_dbl(int x);
 inline int to_pos_int(double x);
 inline double trunc_p(double x);
+inline double log1mexp(double x);
+inline double logaddexp(double x, double y);
+inline double logdiffexp(double x, double y);
+inline double log_interval_prob(double ta, double tb);
+inline double log_interval_surv(double ua, double ub);
+inline bool log_tail_probs(double p, bool lower_tail, bool log_prob,
+                           double& log_pl, double& log_pu);
+
+template <typename F>
+inline double invcdf_newton(const F& eval, double log_p, bool upper,
+                            double x, double lo, double hi);
+
+template <typename F>
+inline bool make_mode_table(const F& ratio, double lo, double hi,
+                            double max_size, pmf_table& tab);
+inline double table_pmf(const pmf_table& tab, double x);
+inline double table_cdf(const pmf_table& tab, double x);
+inline double table_quantile(const pmf_table& tab, double p);
+
+template <int N, typename F>
+inline double cached_eval(value_cache<N>& cache, std::array<double, N> key,
+                          bool cacheable, const F& eval);
+
+template <typename D, typename S, typename F>
+inline double censored_loglik(double status, const D& log_f, const S& log_s,
+                              const F& log_F, bool& throw_warning);
+
+inline double log_lower(double p, double q);
+inline double log_upper(double p, double q);
+template <typename Q>
+inline void rng_sorted(Rcpp::NumericVector& x, const Q& quantile);
+inline void rng_extreme_probs(double size, bool minimum, double& p, double& q);
+inline void sort_na_last(Rcpp::NumericVector& x);
 
 #include "shared_inline.h"
 
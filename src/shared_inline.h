@@ -6,6 +6,26 @@
 #include <Rcpp.h>
 
 
+inline void note_non_integer(double x) {
+  note_diagnostic(DIAG_NON_INTEGER, x);
+}
+
+inline void note_improper(double x) {
+  note_diagnostic(DIAG_IMPROPER, x);
+}
+
+inline void note_int_coercion() {
+  note_diagnostic(DIAG_INT_COERCION, NA_REAL);
+}
+
+inline void note_approximation() {
+  note_diagnostic(DIAG_APPROXIMATION, NA_REAL);
+}
+
+inline void note_no_convergence(double x) {
+  note_diagnostic(DIAG_NO_CONVERGENCE, x);
+}
+
 inline bool tol_equal(double x, double y) {
   return std::abs(x - y) < MIN_DIFF_EPS;
 }
@@ -39,6 +59,17 @@ inline double rng_sign() {
   return (u > 0.5) ? 1.0 : -1.0;
 }
 
+// first j such that cdf[j] >= u, the last index of the table if there is none
+inline int rng_table(double u, const cdf_table& tab) {
+  int K = tab.cdf.size();
+  int G = tab.guide.size();
+  int g = static_cast<int>(u * to_dbl(G));
+  int j = tab.guide[g < G ? g : G - 1];
+  while (j < K - 1 && tab.cdf[j] < u)
+    j++;
+  return j;
+}
+
 inline bool is_large_int(double x) {
   if (x > std::numeric_limits<int>::max())
     return true;
@@ -49,11 +80,9 @@ inline double to_dbl(int x) {
   return static_cast<double>(x);
 }
 
+// x needs to be checked by the caller to be non-negative
+// and within the integer range (see is_large_int)
 inline int to_pos_int(double x) {
-  if (x < 0.0 || ISNAN(x))
-    Rcpp::stop("value cannot be coerced to integer");
-  if (is_large_int(x))
-    Rcpp::stop("value out of integer range");
   return static_cast<int>(x);
 }
 
@@ -61,6 +90,360 @@ inline double trunc_p(double x) {
   return x < 0.0 ? 0.0 : (x > 1.0 ? 1.0 : x); 
 }
 
+// log(1 - exp(x)) for x <= 0, see Maechler (2012)
+inline double log1mexp(double x) {
+  return (x > -LOG_2F) ? std::log(-std::expm1(x)) : std::log1p(-std::exp(x));
+}
+
+// log(exp(x) + exp(y))
+inline double logaddexp(double x, double y) {
+  if (x < y)
+    std::swap(x, y);
+  if (y == R_NegInf)
+    return x;
+  return x + std::log1p(std::exp(y - x));
+}
 
-#endif
+// log(exp(x) - exp(y)) for x >= y
+inline double logdiffexp(double x, double y) {
+  if (y == R_NegInf)
+    return x;
+  return x + log1mexp(y - x);
+}
+
+// log P(a < X <= b) for the cdf written as F(x) = exp(-t(x)), given
+// ta = t(a) and tb = t(b), i.e. log(exp(-tb) - exp(-ta)) that does not
+// lose precision in any of the tails
+inline double log_interval_prob(double ta, double tb) {
+  if (!(ta > tb))
+    return R_NegInf;
+  return -tb + log1mexp(tb - ta);
+}
+
+// the same for the survival function written as S(x) = exp(-u(x))
+inline double log_interval_surv(double ua, double ub) {
+  if (!(ub > ua))
+    return R_NegInf;
+  return -ua + log1mexp(ua - ub);
+}
+
+// log-probabilities of the lower and of the upper tail for p given
+// as in lower_tail and log_prob arguments, false if p is not valid
+inline bool log_tail_probs(double p, bool lower_tail, bool log_prob,
+                           double& log_pl, double& log_pu) {
+  if (log_prob ? p > 0.0 : !VALID_PROB(p))
+    return false;
+  double lp = log_prob ? p : std::log(p);
+  log_pl = lower_tail ? lp : log1mexp(lp);
+  log_pu = lower_tail ? log1mexp(lp) : lp;
+  return true;
+}
+
+/*
+ * Safeguarded Newton-Halley iterations for inverting a continuous cdf
+ * 
+ * The equation log P(x) = log_p is solved, where P is the lower, or
+ * the upper (if upper == true) tail probability, what keeps the steps
+ * well scaled far in the tails. eval(x, log_P, log_d, h) sets log_P to
+ * log P(x), log_d to the log-density and h to the derivative of the
+ * log-density at x, or NAN if it is not available, what gives Newton
+ * steps instead of Halley steps. The root is kept bracketed in [lo, hi],
+ * steps that leave the bracket are replaced by bisection, or by doubling
+ * the distance from the bracket if it is unbounded. The iterations stop
+ * when the relative step, or the difference of log-probabilities, is
+ * below machine precision, and after at most INVCDF_MAXIT evaluations
+ * of eval().
+ * 
+ */
+
+template <typename F>
+inline double invcdf_newton(const F& eval, double log_p, bool upper,
+                            double x, double lo, double hi) {
+  
+  double log_P, log_d, h, g, r, dx, c, x_new;
+  
+  for (int i = 0; i < INVCDF_MAXIT; i++) {
+    
+    eval(x, log_P, log_d, h);
+    g = upper ? log_p - log_P : log_P - log_p;  // increasing in x
+    
+    if (g == 0.0)
+      return x;
+    if (g < 0.0)
+      lo = x;
+    else
+      hi = x;
+    
+    // g'(x) = d(x)/P(x), g''(x)/g'(x) = h(x) -/+ d(x)/P(x)
+    x_new = NAN;
+    r = std::exp(log_d - log_P);
+    if (r > 0.0 && R_FINITE(r)) {
+      dx = g/r;
+      if (!ISNAN(h)) {
+        c = 1.0 - 0.5*dx*(upper ? h + r : h - r);
+        if (c > 0.5 && c < 2.0)
+          dx /= c;
+      }
+      x_new = x - dx;
+      if (std::abs(dx) <= 4.0 * DBL_EPSILON * std::abs(x) ||
+          std::abs(g) <= 4.0 * DBL_EPSILON * std::max(1.0, std::abs(log_p)))
+        return x_new;
+    }
+    
+    if (!(x_new > lo && x_new < hi)) {
+      if (R_FINITE(lo) && R_FINITE(hi))
+        x_new = lo + (hi - lo)/2.0;
+      else if (R_FINITE(lo))
+        x_new = lo + (lo != 0.0 ? std::abs(lo) : 1.0);
+      else
+        x_new = hi - (hi != 0.0 ? std::abs(hi) : 1.0);
+      if (std::abs(x_new - x) <= 4.0 * DBL_EPSILON * std::abs(x_new))
+        return x_new;
+    }
+    
+    x = x_new;
+    
+  }
+  
+  return x;
+}
 
+
+/*
+ * Mode-centred probability tables
+ * 
+ * Probabilities of a discrete distribution on {lo, lo+1, ..., hi} (hi may
+ * be infinite) are computed by the recurrence f(k+1) = f(k) * ratio(k),
+ * starting from f(mode) = 1 and going outward in both directions, so that
+ * nothing underflows close to the mode. The pmf needs to be log-concave,
+ * i.e. ratio(k) needs to be non-increasing: then the mode is the first k
+ * such that ratio(k) <= 1 and the probability beyond f(k) in the direction
+ * of the recurrence is bounded by f(k) * rho/(1-rho), where rho is the last
+ * ratio. The recurrence stops when the bound drops below TABLE_TOL, and
+ * the table is normalized by its sum, so that the memory and time needed
+ * scale with the effective support of the distribution rather than with
+ * its range. If the table would have more than max_size elements, false
+ * is returned and the table is left empty.
+ * 
+ */
+
+template <typename F>
+inline bool make_mode_table(const F& ratio, double lo, double hi,
+                            double max_size, pmf_table& tab) {
+  
+  double mode, a, b, mid, step, k, v, rho, total;
+  
+  // mode is the first k such that ratio(k) <= 1, or hi, found by
+  // exponential search followed by bisection
+  a = lo;
+  b = lo;
+  step = 1.0;
+  while (b < hi && ratio(b) > 1.0) {
+    a = b + 1.0;
+    b = std::min(hi, b + step);
+    step *= 2.0;
+  }
+  while (a < b) {
+    mid = std::floor((a + b) / 2.0);
+    if (ratio(mid) > 1.0)
+      a = mid + 1.0;
+    else
+      b = mid;
+  }
+  mode = a;
+  
+  std::vector<double> left, right;
+  
+  k = mode;
+  v = 1.0;
+  while (k > lo) {
+    rho = 1.0 / ratio(k - 1.0);
+    v *= rho;
+    k -= 1.0;
+    left.push_back(v);
+    if (rho < 1.0 && v * rho / (1.0 - rho) < TABLE_TOL)
+      break;
+    if (to_dbl(left.size()) >= max_size)
+      return false;
+  }
+  tab.first = k;
+  
+  k = mode;
+  v = 1.0;
+  right.push_back(v);
+  while (k < hi) {
+    rho = ratio(k);
+    v *= rho;
+    k += 1.0;
+    right.push_back(v);
+    if (rho < 1.0 && v * rho / (1.0 - rho) < TABLE_TOL)
+      break;
+    if (to_dbl(left.size() + right.size()) > max_size)
+      return false;
+  }
+  
+  tab.pmf.assign(left.rbegin(), left.rend());
+  tab.pmf.insert(tab.pmf.end(), right.begin(), right.end());
+  
+  int K = tab.pmf.size();
+  total = 0.0;
+  for (int j = 0; j < K; j++)
+    total += tab.pmf[j];
+  
+  tab.cum.cdf.resize(K);
+  v = 0.0;
+  for (int j = 0; j < K; j++) {
+    tab.pmf[j] /= total;
+    v += tab.pmf[j];
+    tab.cum.cdf[j] = v;
+  }
+  tab.cum.cdf[K-1] = 1.0;
+  tab.cum.guide.clear();
+  return true;
+}
+
+// x needs to be an integer
+inline double table_pmf(const pmf_table& tab, double x) {
+  double j = x - tab.first;
+  if (j < 0.0 || j >= to_dbl(tab.pmf.size()))
+    return 0.0;
+  return tab.pmf[static_cast<int>(j)];
+}
+
+// P(X <= floor(x))
+inline double table_cdf(const pmf_table& tab, double x) {
+  double j = std::floor(x) - tab.first;
+  if (j < 0.0)
+    return 0.0;
+  if (j >= to_dbl(tab.cum.cdf.size()))
+    return 1.0;
+  return tab.cum.cdf[static_cast<int>(j)];
+}
+
+// smallest x such that P(X <= x) >= p
+inline double table_quantile(const pmf_table& tab, double p) {
+  std::vector<double>::const_iterator it = std::lower_bound(
+    tab.cum.cdf.begin(), tab.cum.cdf.end(), p
+  );
+  if (it == tab.cum.cdf.end())
+    --it;
+  return tab.first + to_dbl(it - tab.cum.cdf.begin());
+}
+
+
+// eval() is called only for the keys that were not seen before; keys with
+// NaN's never compare equal, so they are not cached
+template <int N, typename F>
+inline double cached_eval(value_cache<N>& cache, std::array<double, N> key,
+                          bool cacheable, const F& eval) {
+  if (!cache.active || !cacheable)
+    return eval();
+  for (int j = 0; j < N; j++) {
+    if (ISNAN(key[j]))
+      return eval();
+    key[j] += 0.0;  // -0 and 0 need to hash equally
+  }
+  // the hit rate is checked once, after DEDUP_PROBE lookups, whether the
+  // last of them was a hit or not
+  if (cache.lookups == DEDUP_PROBE && 2 * cache.hits < DEDUP_PROBE) {
+    cache.active = false;
+    cache.values.clear();
+    return eval();
+  }
+  cache.lookups++;
+  auto it = cache.values.find(key);
+  if (it != cache.values.end()) {
+    cache.hits++;
+    return it->second;
+  }
+  double res = eval();
+  if (cache.values.size() < static_cast<std::size_t>(DEDUP_MAX_SIZE))
+    cache.values.emplace(key, res);
+  return res;
+}
+
+// log-likelihood contribution of an observation with given censoring
+// status: log-density for events, log-survival for right-censored and
+// log-cdf for left-censored observations; only the needed one is evaluated
+template <typename D, typename S, typename F>
+inline double censored_loglik(double status, const D& log_f, const S& log_s,
+                              const F& log_F, bool& throw_warning) {
+  if (status == CENS_EVENT)
+    return log_f();
+  if (status == CENS_RIGHT)
+    return log_s();
+  if (status == CENS_LEFT)
+    return log_F();
+  throw_warning = true;
+  return NAN;
+}
+
+// log(p) and log(q) for complementary probabilities p + q = 1, using the
+// smaller of the two, which is the one known to full relative precision;
+// the invcdf_pq_* quantile functions take both probabilities this way and
+// pass one of the logs to invcdf_logp_*, or to invcdf_logq_* functions
+inline double log_lower(double p, double q) {
+  return (p < q) ? std::log(p) : std::log1p(-q);
+}
+
+inline double log_upper(double p, double q) {
+  return (q < p) ? std::log(q) : std::log1p(-p);
+}
+
+// fills x with an ascending sample of quantile(p, q), where p are sorted
+// standard uniforms and q = 1 - p. The uniforms are normalized partial
+// sums of n+1 standard exponential spacings, so the sample is drawn in
+// O(n) time without sorting. Probabilities below one half are accumulated
+// from the left and the ones above from the right, so that both tails
+// keep their relative precision.
+template <typename Q>
+inline void rng_sorted(Rcpp::NumericVector& x, const Q& quantile) {
+  int n = x.length();
+  double last = R::exp_rand();
+  double total = last;
+  for (int i = 0; i < n; i++) {
+    x[i] = R::exp_rand();
+    total += x[i];
+  }
+  double half = total / 2.0;
+  double s = 0.0, p, q, e;
+  int i = 0;
+  for (; i < n && s + x[i] <= half; i++) {
+    s += x[i];
+    p = s / total;
+    x[i] = quantile(p, 1.0 - p);
+  }
+  s = last;
+  for (int j = n - 1; j >= i; j--) {
+    e = x[j];
+    q = s / total;
+    x[j] = quantile(1.0 - q, q);
+    s += e;
+  }
+}
+
+// complementary probabilities p and q = 1 - p at which the quantile function
+// needs to be evaluated to draw the maximum (or the minimum) of size
+// independent draws: the maximum has cdf F^size, so p = U^(1/size), and
+// for the minimum q = U^(1/size); the smaller one is found by expm1
+inline void rng_extreme_probs(double size, bool minimum, double& p, double& q) {
+  double e = R::exp_rand() / size;  // -log(U)/size
+  double u = std::exp(-e);
+  double v = -std::expm1(-e);
+  if (minimum) {
+    p = v;
+    q = u;
+  } else {
+    p = u;
+    q = v;
+  }
+}
+
+// sorts x in increasing order, with the missing values placed last
+inline void sort_na_last(Rcpp::NumericVector& x) {
+  std::sort(x.begin(), x.end(), [](double a, double b) {
+    return a < b || (!ISNAN(a) && ISNAN(b));
+  });
+}
+
+#endif
@@ -78,7 +78,131 @@ inline double cdf_sgomp(double x, double b, double eta,
     return 1.0;
   double ebx = exp(-b*x);
   // (1-ebx) * exp(-eta*ebx)
-  return exp(log1p(-ebx) - eta*ebx);
+  return exp(log(-expm1(-b*x)) - eta*ebx);
+}
+
+/*
+ * S(x) = 1 - (1-u) * exp(-eta*u) = u * ((1-exp(-eta*u))/u + exp(-eta*u)),
+ * u = exp(-b*x), so log S(x) = -b*x + log(...) is a sum of positive terms
+ * that stays accurate in the upper tail, also after u underflows, where
+ * S(x) ~ (1+eta)*u.
+ */
+
+inline double logsurv_sgomp(double x, double b, double eta) {
+  double u = exp(-b*x);
+  double r = (eta*u < 1e-8) ? eta*(1.0 - eta*u/2.0) : -expm1(-eta*u)/u;
+  return -b*x + log(r + exp(-eta*u));
+}
+
+/*
+ * X = max(E, G), where E ~ Exponential(b) and G ~ Gumbel(log(eta)/b, 1/b),
+ * so the larger of their quantiles is used as a starting value, in the
+ * upper tail the asymptotic -log(p/(1+eta))/b, and near zero the quantile
+ * of E for p*exp(eta). Quantile is found
+ * by Halley iterations (see invcdf_newton) with
+ * d/dx log f(x) = -b + eta*b*u + eta*b*u/(1 + eta*(1-u)), u = exp(-b*x).
+ */
+
+inline double logcens_sgomp(double x, double status, double b, double eta,
+                            bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(b) || ISNAN(eta))
+    return x+status+b+eta;
+#endif
+  if (b <= 0.0 || eta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  // F(x) = (1-exp(-b*x)) * exp(-eta*exp(-b*x))
+  auto log_F = [&]() -> double {
+    if (x < 0.0)
+      return R_NegInf;
+    if (x == R_PosInf)
+      return 0.0;
+    return log(-expm1(-b*x)) - eta*exp(-b*x);
+  };
+  return censored_loglik(status, [&]() {
+    return logpdf_sgomp(x, b, eta, throw_warning);
+  }, [&]() {
+    if (x < 0.0)
+      return 0.0;
+    if (x == R_PosInf)
+      return R_NegInf;
+    return logsurv_sgomp(x, b, eta);
+  }, log_F, throw_warning);
+}
+
+inline double hazard_sgomp(double x, double b, double eta, bool cumulative,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(b) || ISNAN(eta))
+    return x+b+eta;
+#endif
+  if (b <= 0.0 || eta <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (x < 0.0)
+    return cumulative ? 0.0 : R_NegInf;
+  if (x == R_PosInf)
+    return cumulative ? R_PosInf : log(b);
+  double ebx = exp(-b*x);
+  double log_S = logsurv_sgomp(x, b, eta);
+  if (cumulative)
+    return -log_S;
+  return log(b) - b*x - eta*ebx + log1p(eta*(1.0-ebx)) - log_S;
+}
+
+inline double invcdf_sgomp(double p, double b, double eta,
+                           bool lower_tail, bool log_prob,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(b) || ISNAN(eta))
+    return p+b+eta;
+#endif
+  double log_pl, log_pu;
+  if (b <= 0.0 || eta <= 0.0 ||
+      !log_tail_probs(p, lower_tail, log_prob, log_pl, log_pu)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (log_pl == R_NegInf)
+    return 0.0;
+  if (log_pu == R_NegInf)
+    return R_PosInf;
+  
+  bool upper = log_pl > -M_LN2;
+  double log_pt, x0;
+  if (upper) {
+    log_pt = log_pu;
+    x0 = std::max({
+      -log_pu/b,
+      -log(-log_pl/eta)/b,
+      -(log_pu - log1p(eta))/b
+    });
+  } else {
+    log_pt = log_pl;
+    x0 = std::max(
+      -log_pu/b,
+      -log(-log_pl/eta)/b
+    );
+    // near zero F(x) ~ (1-exp(-b*x)) * exp(-eta)
+    if (log_pl + eta < 0.0) {
+      double x1 = -log1mexp(log_pl + eta)/b;
+      if (eta*b*x1 < 1.0)
+        x0 = x1;
+    }
+  }
+  
+  auto eval = [&](double x, double& log_P, double& log_d, double& h) {
+    bool tw = false;
+    double ebx = exp(-b*x);
+    log_P = upper ? logsurv_sgomp(x, b, eta) : log(-expm1(-b*x)) - eta*ebx;
+    log_d = logpdf_sgomp(x, b, eta, tw);
+    h = -b + eta*b*ebx + eta*b*ebx/(1.0 + eta*(1.0-ebx));
+  };
+  
+  return invcdf_newton(eval, log_pt, upper, x0, 0.0, R_PosInf);
 }
 
 inline double rng_sgomp(double b, double eta, bool& throw_warning) {
@@ -169,6 +293,39 @@ NumericVector cpp_psgomp(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qsgomp(
+    const NumericVector& p,
+    const NumericVector& b,
+    const NumericVector& eta,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), b.length(), eta.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    b.length(),
+    eta.length()
+  });
+  NumericVector q(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    q[i] = invcdf_sgomp(GETV(p, i), GETV(b, i), GETV(eta, i),
+                        lower_tail, log_prob, throw_warning);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return q;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rsgomp(
     const int& n,
@@ -195,3 +352,78 @@ NumericVector cpp_rsgomp(
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_sgomp(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& b,
+    const NumericVector& eta,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(), b.length(), eta.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    b.length(),
+    eta.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_sgomp(GETV(x, i), GETV(status, i), GETV(b, i), GETV(eta, i),
+                         throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
+
+
+// [[Rcpp::export]]
+NumericVector cpp_hazard_sgomp(
+    const NumericVector& x,
+    const NumericVector& b,
+    const NumericVector& eta,
+    const bool& cumulative = false,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), b.length(), eta.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    b.length(),
+    eta.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = hazard_sgomp(GETV(x, i), GETV(b, i), GETV(eta, i), cumulative,
+                        throw_warning);
+  
+  // hazard is computed on log scale, cumulative hazard is not
+  if (cumulative && log_prob)
+    p = Rcpp::log(p);
+  else if (!cumulative && !log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
@@ -69,13 +69,17 @@ NumericVector cpp_dskellam(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = pmf_skellam(GETV(x, i), GETV(mu1, i),
                        GETV(mu2, i), throw_warning);
+  }
   
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -24,8 +24,17 @@ using Rcpp::NumericVector;
  */
 
 
-inline double pdf_slash(double x, double mu, double sigma,
-                        bool& throw_warning) {
+/*
+ * f(z) = phi(0) * (1 - exp(-t))/t / (2 sigma), where t = z^2/2,
+ * 
+ * so near zero the log-density is computed from the series
+ * log((1 - exp(-t))/t) = -t/2 + t^2/24 - t^4/2880 + O(t^6)
+ * to avoid the cancellation in phi(0) - phi(z).
+ * 
+ */
+
+inline double logpdf_slash(double x, double mu, double sigma,
+                           bool& throw_warning) {
 #ifdef IEEE_754
   if (ISNAN(x) || ISNAN(mu) || ISNAN(sigma))
     return x+mu+sigma;
@@ -34,10 +43,14 @@ inline double pdf_slash(double x, double mu, double sigma,
     throw_warning = true;
     return NAN;
   }
-  double z = (x - mu)/sigma;
-  if (z == 0.0)
-    return 0.19947114020071635; // 1.0/(2.0 * SQRT_2_PI);
-  return ((PHI_0 - phi(z))/(z*z))/sigma;
+  double z = abs(x - mu)/sigma;
+  if (z < 0.15) {
+    double t = z*z/2.0;
+    double t2 = t*t;
+    return -M_LN_SQRT_2PI - M_LN2 - t/2.0 + t2/24.0 -
+      t2*t2/2880.0 - log(sigma);
+  }
+  return -M_LN_SQRT_2PI + log1mexp(-z*z/2.0) - 2.0*log(z) - log(sigma);
 }
 
 inline double cdf_slash(double x, double mu, double sigma,
@@ -56,6 +69,50 @@ inline double cdf_slash(double x, double mu, double sigma,
   return Phi(z) - (PHI_0 - phi(z))/z;
 }
 
+/*
+ * The distribution is symmetric, so P(Z > z) = min(p, 1-p) is solved
+ * for z >= 0 by Halley iterations (see invcdf_newton), with
+ * d/dz log f(z) = phi(z)/(z f(z)) - 2/z. For small tail probabilities
+ * P(Z > z) ~ phi(0)/z, what is used as a starting value.
+ */
+
+inline double invcdf_slash(double p, double mu, double sigma,
+                           bool lower_tail, bool log_prob,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(sigma))
+    return p+mu+sigma;
+#endif
+  double log_pl, log_pu;
+  if (sigma <= 0.0 ||
+      !log_tail_probs(p, lower_tail, log_prob, log_pl, log_pu)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (log_pl == R_NegInf)
+    return R_NegInf;
+  if (log_pu == R_NegInf)
+    return R_PosInf;
+  if (log_pl == log_pu)
+    return mu;
+  
+  double log_pt = std::min(log_pl, log_pu);
+  double z0 = (log_pt < log(0.2)) ? exp(log(PHI_0) - log_pt) :
+              (0.5 - exp(log_pt))/0.19947114020071635;
+  double z = R_PosInf;
+  
+  auto eval = [](double z, double& log_P, double& log_d, double& h) {
+    bool tw = false;
+    log_P = log(cdf_slash(-z, 0.0, 1.0, tw));
+    log_d = logpdf_slash(z, 0.0, 1.0, tw);
+    h = (z > 1e-4) ? exp(lphi(z) - log_d)/z - 2.0/z : NAN;
+  };
+  
+  if (R_FINITE(z0))
+    z = invcdf_newton(eval, log_pt, true, z0, 0.0, R_PosInf);
+  return (log_pl < log_pu) ? mu - z*sigma : mu + z*sigma;
+}
+
 inline double rng_slash(double mu, double sigma,
                         bool& throw_warning) {
   if (ISNAN(mu) || ISNAN(sigma) || sigma <= 0.0) {
@@ -90,11 +147,11 @@ NumericVector cpp_dslash(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_slash(GETV(x, i), GETV(mu, i),
-                     GETV(sigma, i), throw_warning);
+    p[i] = logpdf_slash(GETV(x, i), GETV(mu, i),
+                        GETV(sigma, i), throw_warning);
   
-  if (log_prob)
-    p = Rcpp::log(p);
+  if (!log_prob)
+    p = Rcpp::exp(p);
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -142,6 +199,39 @@ NumericVector cpp_pslash(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qslash(
+    const NumericVector& p,
+    const NumericVector& mu,
+    const NumericVector& sigma,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), mu.length(), sigma.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    mu.length(),
+    sigma.length()
+  });
+  NumericVector q(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    q[i] = invcdf_slash(GETV(p, i), GETV(mu, i), GETV(sigma, i),
+                        lower_tail, log_prob, throw_warning);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return q;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rslash(
     const int& n,
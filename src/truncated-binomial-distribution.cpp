@@ -99,6 +99,48 @@ inline double rng_tbinom(double size, double prob, double a,
   return R::qbinom(u, size, prob, true, false);
 }
 
+// quantile for the logs of complementary probabilities p + q = 1, found in
+// the smaller of the tails: P(a < X <= x) = p * P(a < X <= b) in the lower
+// and P(x < X <= b) = q * P(a < X <= b) in the upper one
+inline double invcdf_logpq_tbinom(double log_p, double log_q, double size,
+                                  double prob, double a, double b) {
+  bool lower = log_p < log_q;
+  double la = R::pbinom(a, size, prob, lower, true);
+  double lb = R::pbinom(b, size, prob, lower, true);
+  double x;
+  if (lower)
+    x = R::qbinom(logaddexp(la, log_p + logdiffexp(lb, la)),
+                  size, prob, true, true);
+  else
+    x = R::qbinom(logaddexp(lb, log_q + logdiffexp(la, lb)),
+                  size, prob, false, true);
+  return std::min(std::max(x, floor(a) + 1.0), floor(b));
+}
+
+extern const mix_family mix_tbinom = {
+  "tbinom", 4, true,
+  [](const double* t) -> bool {
+    return t[0] >= 0.0 && isInteger(t[0], false) && VALID_PROB(t[1]) &&
+           t[3] >= t[2];
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_tbinom(x, t[0], t[1], t[2], t[3], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    double p = cdf_tbinom(x, t[0], t[1], t[2], t[3], tw);
+    return lower_tail ? log(p) : log1p(-p);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    return invcdf_logpq_tbinom(log_p, log_q, t[0], t[1], t[2], t[3]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_tbinom(t[0], t[1], t[2], t[3], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dtbinom(
@@ -126,14 +168,18 @@ NumericVector cpp_dtbinom(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = logpdf_tbinom(GETV(x, i), GETV(size, i),
                          GETV(prob, i), GETV(lower, i),
                          GETV(upper, i), throw_warning);
+  }
   
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -102,6 +102,47 @@ inline double rng_tpois(double lambda, double a, double b,
   return R::qpois(u, lambda, true, false);
 }
 
+// quantile for the logs of complementary probabilities p + q = 1, found in
+// the smaller of the tails: P(a < X <= x) = p * P(a < X <= b) in the lower
+// and P(x < X <= b) = q * P(a < X <= b) in the upper one
+inline double invcdf_logpq_tpois(double log_p, double log_q, double lambda,
+                                 double a, double b) {
+  bool lower = log_p < log_q;
+  double la = R::ppois(a, lambda, lower, true);
+  double lb = R::ppois(b, lambda, lower, true);
+  double x;
+  if (lower)
+    x = R::qpois(logaddexp(la, log_p + logdiffexp(lb, la)),
+                 lambda, true, true);
+  else
+    x = R::qpois(logaddexp(lb, log_q + logdiffexp(la, lb)),
+                 lambda, false, true);
+  return std::min(std::max(x, floor(a) + 1.0), floor(b));
+}
+
+extern const mix_family mix_tpois = {
+  "tpois", 3, true,
+  [](const double* t) -> bool {
+    return t[0] >= 0.0 && t[2] >= t[1];
+  },
+  [](double x, const double* t) -> double {
+    bool tw = false;
+    return logpdf_tpois(x, t[0], t[1], t[2], tw);
+  },
+  [](double x, const double* t, bool lower_tail) -> double {
+    bool tw = false;
+    double p = cdf_tpois(x, t[0], t[1], t[2], tw);
+    return lower_tail ? log(p) : log1p(-p);
+  },
+  [](double log_p, double log_q, const double* t) -> double {
+    return invcdf_logpq_tpois(log_p, log_q, t[0], t[1], t[2]);
+  },
+  [](const double* t) -> double {
+    bool tw = false;
+    return rng_tpois(t[0], t[1], t[2], tw);
+  }
+};
+
 
 // [[Rcpp::export]]
 NumericVector cpp_dtpois(
@@ -127,14 +168,18 @@ NumericVector cpp_dtpois(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
     p[i] = logpdf_tpois(GETV(x, i), GETV(lambda, i),
                         GETV(lower, i), GETV(upper, i),
                         throw_warning);
+  }
   
   if (!log_prob)
     p = Rcpp::exp(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   
@@ -49,6 +49,23 @@ inline double rng_tlambda(double lambda, bool& throw_warning) {
   return (pow(u, lambda) - pow(1.0 - u, lambda))/lambda;
 }
 
+inline double invcdf_pq_tlambda(double p, double q, double lambda) {
+  if (lambda == 0.0)
+    return log_lower(p, q) - log_upper(p, q);
+  return (pow(p, lambda) - pow(q, lambda))/lambda;
+}
+
+inline double rng_extreme_tlambda(double size, double lambda, bool minimum,
+                                  bool& throw_warning) {
+  if (ISNAN(size) || ISNAN(lambda) || size <= 0.0) {
+    throw_warning = true;
+    return NA_REAL;
+  }
+  double p, q;
+  rng_extreme_probs(size, minimum, p, q);
+  return invcdf_pq_tlambda(p, q, lambda);
+}
+
 
 // [[Rcpp::export]]
 NumericVector cpp_qtlambda(
@@ -91,7 +108,8 @@ NumericVector cpp_qtlambda(
 // [[Rcpp::export]]
 NumericVector cpp_rtlambda(
     const int& n,
-    const NumericVector& lambda
+    const NumericVector& lambda,
+    const bool& sorted = false
   ) {
   
   if (lambda.length() < 1) {
@@ -103,12 +121,54 @@ NumericVector cpp_rtlambda(
   
   bool throw_warning = false;
     
+  if (sorted && lambda.length() == 1) {
+    if (ISNAN(lambda[0])) {
+      Rcpp::warning("NAs produced");
+      return NumericVector(n, NA_REAL);
+    }
+    rng_sorted(x, [&](double p, double q) -> double {
+      return invcdf_pq_tlambda(p, q, lambda[0]);
+    });
+    return x;
+  }
+
   for (int i = 0; i < n; i++)
     x[i] = rng_tlambda(GETV(lambda, i), throw_warning);
   
+  if (sorted)
+    sort_na_last(x);
+
   if (throw_warning)
     Rcpp::warning("NAs produced");
   
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_rextreme_tlambda(
+    const int& n,
+    const NumericVector& size,
+    const NumericVector& lambda,
+    const bool& minimum = false
+  ) {
+
+  if (std::min({size.length(), lambda.length()}) < 1) {
+    Rcpp::warning("NAs produced");
+    return NumericVector(n, NA_REAL);
+  }
+
+  NumericVector x(n);
+
+  bool throw_warning = false;
+
+  for (int i = 0; i < n; i++)
+    x[i] = rng_extreme_tlambda(GETV(size, i), GETV(lambda, i), minimum,
+                               throw_warning);
+
+  if (throw_warning)
+    Rcpp::warning("NAs produced");
+
+  return x;
+}
+
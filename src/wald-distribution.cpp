@@ -26,8 +26,8 @@ using Rcpp::NumericVector;
  * 
  */
 
-inline double pdf_wald(double x, double mu, double lambda,
-                       bool& throw_warning) {
+inline double logpdf_wald(double x, double mu, double lambda,
+                          bool& throw_warning) {
 #ifdef IEEE_754
   if (ISNAN(x) || ISNAN(mu) || ISNAN(lambda))
     return x+mu+lambda;
@@ -37,9 +37,26 @@ inline double pdf_wald(double x, double mu, double lambda,
     return NAN;
   }
   if (x <= 0.0 || !R_FINITE(x))
-    return 0.0;
-  return sqrt(lambda/(2.0*M_PI*(x*x*x))) *
-         exp( (-lambda*(x-mu)*(x-mu))/(2.0*(mu*mu)*x) );
+    return R_NegInf;
+  // sqrt(lambda/(2*pi*x^3)) * exp(-lambda*(x-mu)^2/(2*mu^2*x))
+  return 0.5*(log(lambda) - 3.0*log(x)) - M_LN_SQRT_2PI -
+         (lambda*(x-mu)*(x-mu))/(2.0*(mu*mu)*x);
+}
+
+// log P(X <= x) or log P(X > x) for 0 < x < Inf, computed in log-space,
+// so exp(2*lambda/mu) does not overflow for large lambda/mu
+
+inline double log_wald_tail(double x, double mu, double lambda,
+                            bool lower_tail) {
+  double r = sqrt(lambda/x);
+  double log_a = R::pnorm(r*(x/mu-1.0), 0.0, 1.0, lower_tail, true);
+  double log_b = 2.0*lambda/mu +
+                 R::pnorm(-r*(x/mu+1.0), 0.0, 1.0, true, true);
+  if (lower_tail)
+    return logaddexp(log_a, log_b);
+  if (log_b >= log_a)
+    return R_NegInf;
+  return logdiffexp(log_a, log_b);
 }
 
 inline double cdf_wald(double x, double mu, double lambda,
@@ -56,9 +73,75 @@ inline double cdf_wald(double x, double mu, double lambda,
     return 0.0;
   if (x == R_PosInf)
     return 1.0;
-  return Phi(sqrt(lambda/x)*(x/mu-1.0)) +
-         exp((2.0*lambda)/mu) *
-         Phi(-sqrt(lambda/x)*(x/mu+1.0));
+  return exp(log_wald_tail(x, mu, lambda, true));
+}
+
+inline double logcens_wald(double x, double status, double mu, double lambda,
+                           bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(x) || ISNAN(status) || ISNAN(mu) || ISNAN(lambda))
+    return x+status+mu+lambda;
+#endif
+  if (mu <= 0.0 || lambda <= 0.0) {
+    throw_warning = true;
+    return NAN;
+  }
+  auto log_tail = [&](bool lower_tail) -> double {
+    if (x <= 0.0)
+      return lower_tail ? R_NegInf : 0.0;
+    if (x == R_PosInf)
+      return lower_tail ? 0.0 : R_NegInf;
+    return log_wald_tail(x, mu, lambda, lower_tail);
+  };
+  return censored_loglik(status, [&]() {
+    return logpdf_wald(x, mu, lambda, throw_warning);
+  }, [&]() {
+    return log_tail(false);
+  }, [&]() {
+    return log_tail(true);
+  }, throw_warning);
+}
+
+/*
+ * Quantile function is computed by Halley iterations (see invcdf_newton),
+ * d/dx log f(x) = -3/(2x) - lambda/(2mu^2) + lambda/(2x^2). The starting
+ * value solves sqrt(lambda/x)*(x/mu-1) = z for the normal quantile z, i.e.
+ * it ignores the second term of the cdf. The smaller of the tail
+ * probabilities is inverted.
+ */
+
+inline double invcdf_wald(double p, double mu, double lambda,
+                          bool lower_tail, bool log_prob,
+                          bool& throw_warning) {
+#ifdef IEEE_754
+  if (ISNAN(p) || ISNAN(mu) || ISNAN(lambda))
+    return p+mu+lambda;
+#endif
+  double log_pl, log_pu;
+  if (mu <= 0.0 || lambda <= 0.0 ||
+      !log_tail_probs(p, lower_tail, log_prob, log_pl, log_pu)) {
+    throw_warning = true;
+    return NAN;
+  }
+  if (log_pl == R_NegInf)
+    return 0.0;
+  if (log_pu == R_NegInf)
+    return R_PosInf;
+  
+  bool upper = log_pl > -M_LN2;
+  double log_pt = upper ? log_pu : log_pl;
+  double z = R::qnorm(log_pt, 0.0, 1.0, !upper, true);
+  double y = (z + sqrt(z*z + 4.0*lambda/mu)) * mu/(2.0*sqrt(lambda));
+  double x0 = y*y;
+  
+  auto eval = [&](double x, double& log_P, double& log_d, double& h) {
+    bool tw = false;
+    log_P = log_wald_tail(x, mu, lambda, !upper);
+    log_d = logpdf_wald(x, mu, lambda, tw);
+    h = -1.5/x - lambda/(2.0*mu*mu) + (lambda/(2.0*x))/x;
+  };
+  
+  return invcdf_newton(eval, log_pt, upper, x0, 0.0, R_PosInf);
 }
 
 inline double rng_wald(double mu, double lambda, bool& throw_warning) {
@@ -101,11 +184,11 @@ NumericVector cpp_dwald(
   bool throw_warning = false;
   
   for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_wald(GETV(x, i), GETV(mu, i),
-                    GETV(lambda, i), throw_warning);
+    p[i] = logpdf_wald(GETV(x, i), GETV(mu, i),
+                       GETV(lambda, i), throw_warning);
   
-  if (log_prob)
-    p = Rcpp::log(p);
+  if (!log_prob)
+    p = Rcpp::exp(p);
   
   if (throw_warning)
     Rcpp::warning("NaNs produced");
@@ -153,6 +236,39 @@ NumericVector cpp_pwald(
 }
 
 
+// [[Rcpp::export]]
+NumericVector cpp_qwald(
+    const NumericVector& p,
+    const NumericVector& mu,
+    const NumericVector& lambda,
+    const bool& lower_tail = true,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({p.length(), mu.length(), lambda.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    p.length(),
+    mu.length(),
+    lambda.length()
+  });
+  NumericVector q(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    q[i] = invcdf_wald(GETV(p, i), GETV(mu, i), GETV(lambda, i),
+                       lower_tail, log_prob, throw_warning);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return q;
+}
+
+
 // [[Rcpp::export]]
 NumericVector cpp_rwald(
     const int& n,
@@ -179,3 +295,40 @@ NumericVector cpp_rwald(
   return x;
 }
 
+
+// [[Rcpp::export]]
+NumericVector cpp_dcens_wald(
+    const NumericVector& x,
+    const NumericVector& status,
+    const NumericVector& mu,
+    const NumericVector& lambda,
+    const bool& log_prob = false
+  ) {
+  
+  if (std::min({x.length(), status.length(),
+                mu.length(), lambda.length()}) < 1) {
+    return NumericVector(0);
+  }
+  
+  int Nmax = std::max({
+    x.length(),
+    status.length(),
+    mu.length(),
+    lambda.length()
+  });
+  NumericVector p(Nmax);
+  
+  bool throw_warning = false;
+  
+  for (int i = 0; i < Nmax; i++)
+    p[i] = logcens_wald(GETV(x, i), GETV(status, i), GETV(mu, i),
+                        GETV(lambda, i), throw_warning);
+  
+  if (!log_prob)
+    p = Rcpp::exp(p);
+  
+  if (throw_warning)
+    Rcpp::warning("NaNs produced");
+  
+  return p;
+}
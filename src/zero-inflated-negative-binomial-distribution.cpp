@@ -109,14 +109,25 @@ NumericVector cpp_dzinb(
   
   bool throw_warning = false;
   
-  for (int i = 0; i < Nmax; i++)
-    p[i] = pdf_zinb(GETV(x, i), GETV(size, i),
-                    GETV(prob, i), GETV(pi, i),
-                    throw_warning);
+  value_cache<4> cache(Nmax);
+  double xi, ri, pri, pii;
+  
+  diagnostics& diag = reset_diagnostics();
+  for (int i = 0; i < Nmax; i++) {
+    diag.index = i;
+    xi = GETV(x, i);
+    ri = GETV(size, i);
+    pri = GETV(prob, i);
+    pii = GETV(pi, i);
+    p[i] = cached_eval(cache, {{xi, ri, pri, pii}}, isInteger(xi, false), [&]() {
+      return pdf_zinb(xi, ri, pri, pii, throw_warning);
+    });
+  }
   
   if (log_prob)
     p = Rcpp::log(p);
   
+  report_diagnostics(p);
   if (throw_warning)
     Rcpp::warning("NaNs produced");
   